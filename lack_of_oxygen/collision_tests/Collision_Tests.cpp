@@ -0,0 +1,849 @@
+/**
+ * @file Collision_Tests.cpp
+ * @brief Checks the collision code against its reference implementations, and times it.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include standard headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Include other necessary headers
+#include "../lack_of_oxygen/System/AABB.h"
+#include "../lack_of_oxygen/System/AABB_Tree.h"
+#include "../lack_of_oxygen/System/Broadphase.h"
+#include "../lack_of_oxygen/System/Collision_Batch.h"
+#include "../lack_of_oxygen/System/Tile_Layer.h"
+
+namespace {
+    using namespace lof;
+
+    constexpr unsigned RANDOM_SEED = 20241120;              ///< Seed of every random test, so failures repeat
+    constexpr int BATCH_TRIALS = 20000;                     ///< Number of moving boxes tested by the batch test
+    constexpr std::size_t MAX_BATCH_CANDIDATES = 37;        ///< Most candidates per moving box, not a multiple of any width
+    constexpr int BENCHMARK_BOXES = 1024;                   ///< Number of moving boxes in the benchmark
+    constexpr std::size_t BENCHMARK_CANDIDATES = 256;       ///< Number of candidates of each benchmark box
+    constexpr int BENCHMARK_REPEATS = 20;                   ///< Number of times the benchmark is run
+    constexpr std::size_t BROADPHASE_TEST_BOXES = 1500;     ///< Number of boxes in the broadphase test
+    constexpr int BROADPHASE_TEST_FRAMES = 120;             ///< Number of frames the broadphase test runs
+    constexpr std::size_t BROADPHASE_BENCHMARK_BOXES = 10000;   ///< Number of boxes in the broadphase benchmark
+    constexpr int BROADPHASE_BENCHMARK_FRAMES = 300;        ///< Number of frames the broadphase benchmark runs
+    constexpr int RESPAWN_INTERVAL = 30;                    ///< Frames between respawning some boxes as new entities
+    constexpr int STATIC_MOVE_FRAME = 45;                   ///< Frame of the broadphase test where a static box moves
+    constexpr std::size_t TREE_TEST_BOXES = 800;            ///< Number of boxes in the AABB tree test
+    constexpr int TREE_TEST_ROUNDS = 40;                    ///< Number of rounds of moving and replacing boxes in the tree test
+    constexpr int TREE_TEST_QUERIES = 50;                   ///< Number of box queries and ray casts in each round
+    constexpr float WORLD_SIZE = 4096.0f;                   ///< Width and height of the broadphase scenes
+    constexpr float TILE_SIZE = 32.0f;                      ///< Size of the touching static tiles in the scenes
+    constexpr std::size_t TILE_TEST_TILES = 3000;           ///< Number of tiles in each tile layer test
+    constexpr int TILE_TEST_QUERIES = 5000;                 ///< Number of box queries in each tile layer test
+    constexpr float TILE_TEST_WIDE_SPREAD = 400000.0f;      ///< Spread of the wide tile level, too wide for the default cell size
+    constexpr float DELTA_TIME = 1.0f / 60.0f;              ///< Time step of every test
+
+    const char* path_name(Collision_Batch_Path path) {
+        switch (path) {
+        case Collision_Batch_Path::SCALAR:
+            return "scalar";
+        case Collision_Batch_Path::SSE2:
+            return "SSE2";
+        case Collision_Batch_Path::AVX2:
+            return "AVX2";
+        }
+        return "unknown";
+    }
+
+    std::uint32_t bits_of(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    /**
+     * @brief Make a random box and velocity, covering the cases the per-pair test branches on.
+     * @details Boxes are small and close together so many pairs overlap. Some candidates copy the
+     *          moving box's velocity, share one of its edges, stand still along one axis or have a
+     *          NaN bound, since those pick the per-pair test's equal and unordered branches.
+     */
+    void random_candidate(std::mt19937& random, const AABB& box, const Vec2D& velocity,
+        AABB& candidate, Vec2D& candidate_velocity) {
+        std::uniform_real_distribution<float> position(-40.0f, 40.0f);
+        std::uniform_real_distribution<float> size(1.0f, 30.0f);
+        std::uniform_real_distribution<float> speed(-600.0f, 600.0f);
+        std::uniform_int_distribution<int> kind(0, 9);
+
+        candidate.min = Vec2D(position(random), position(random));
+        candidate.max = Vec2D(candidate.min.x + size(random), candidate.min.y + size(random));
+        candidate_velocity = Vec2D(speed(random), speed(random));
+
+        switch (kind(random)) {
+        case 0:
+            // Zero relative velocity
+            candidate_velocity = velocity;
+            break;
+        case 1:
+            // Touching the moving box's right edge
+            candidate.max.x = candidate.max.x - candidate.min.x + box.max.x;
+            candidate.min.x = box.max.x;
+            break;
+        case 2:
+            // Touching the moving box's bottom edge
+            candidate.min.y = candidate.min.y - candidate.max.y + box.min.y;
+            candidate.max.y = box.min.y;
+            break;
+        case 3:
+            // Zero relative velocity along one axis only
+            candidate_velocity.x = velocity.x;
+            break;
+        case 4:
+            candidate_velocity.y = velocity.y;
+            break;
+        case 5:
+            // Unordered bounds
+            candidate.min.x = std::numeric_limits<float>::quiet_NaN();
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * @brief Compare every supported batch path against the per-pair test.
+     * @return The number of mismatched results.
+     */
+    int test_batch_matches_pair() {
+        std::mt19937 random(RANDOM_SEED);
+        std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> size(1.0f, 30.0f);
+        std::uniform_real_distribution<float> speed(-600.0f, 600.0f);
+        std::uniform_int_distribution<std::size_t> count(0, MAX_BATCH_CANDIDATES);
+
+        Collider_Arrays candidates;
+        std::vector<std::uint8_t> hits;
+        std::vector<float> first_contact;
+        std::vector<std::uint8_t> expected_hits;
+        std::vector<float> expected_first_contact;
+
+        const Collision_Batch_Path paths[] = { Collision_Batch_Path::SCALAR, Collision_Batch_Path::SSE2, Collision_Batch_Path::AVX2 };
+        std::size_t pairs = 0;
+        std::size_t pair_hits = 0;
+        int mismatches = 0;
+
+        for (int trial = 0; trial < BATCH_TRIALS; ++trial) {
+            Vec2D min(position(random), position(random));
+            AABB box(min, Vec2D(min.x + size(random), min.y + size(random)));
+            Vec2D velocity(speed(random), speed(random));
+
+            candidates.clear();
+            expected_hits.clear();
+            expected_first_contact.clear();
+            std::size_t candidate_count = count(random);
+            for (std::size_t candidate = 0; candidate < candidate_count; ++candidate) {
+                AABB candidate_box(Vec2D(0.0f, 0.0f), Vec2D(0.0f, 0.0f));
+                Vec2D candidate_velocity;
+                random_candidate(random, box, velocity, candidate_box, candidate_velocity);
+                candidates.add(candidate_box, candidate_velocity);
+
+                float contact = 0.0f;
+                expected_hits.push_back(collision_intersection_pair(box, velocity, candidate_box, candidate_velocity, contact, DELTA_TIME) ? 1 : 0);
+                expected_first_contact.push_back(contact);
+                pair_hits += expected_hits.back();
+            }
+            pairs += candidate_count;
+
+            for (Collision_Batch_Path path : paths) {
+                if (!collision_batch_supported(path)) {
+                    continue;
+                }
+                collision_intersection_batch(box, velocity, candidates, DELTA_TIME, hits, first_contact, path);
+
+                for (std::size_t candidate = 0; candidate < candidate_count; ++candidate) {
+                    bool hit_differs = hits[candidate] != expected_hits[candidate];
+                    bool contact_differs = expected_hits[candidate] &&
+                        bits_of(first_contact[candidate]) != bits_of(expected_first_contact[candidate]);
+                    if (hit_differs || contact_differs) {
+                        if (mismatches < 10) {
+                            std::cout << "  " << path_name(path) << " trial " << trial << " candidate " << candidate
+                                << ": hit " << int(hits[candidate]) << " expected " << int(expected_hits[candidate])
+                                << ", first contact " << first_contact[candidate] << " expected " << expected_first_contact[candidate] << "\n";
+                        }
+                        ++mismatches;
+                    }
+                }
+            }
+        }
+
+        std::cout << "batch vs pair: " << pairs << " pairs, " << pair_hits << " hits";
+        for (Collision_Batch_Path path : paths) {
+            std::cout << ", " << path_name(path) << (collision_batch_supported(path) ? " tested" : " unsupported");
+        }
+        std::cout << ", " << mismatches << " mismatches\n";
+        return mismatches;
+    }
+
+    /**
+     * @brief Time the per-pair test and every supported batch path over the same scattered boxes.
+     */
+    void benchmark_batch() {
+        std::mt19937 random(RANDOM_SEED);
+        std::uniform_real_distribution<float> position(-40.0f, 40.0f);
+        std::uniform_real_distribution<float> size(1.0f, 30.0f);
+        std::uniform_real_distribution<float> speed(-600.0f, 600.0f);
+
+        std::vector<AABB> boxes;
+        std::vector<Vec2D> velocities;
+        std::vector<Collider_Arrays> candidates(BENCHMARK_BOXES);
+        for (int box_index = 0; box_index < BENCHMARK_BOXES; ++box_index) {
+            Vec2D min(position(random), position(random));
+            boxes.emplace_back(min, Vec2D(min.x + size(random), min.y + size(random)));
+            velocities.emplace_back(speed(random), speed(random));
+            for (std::size_t candidate = 0; candidate < BENCHMARK_CANDIDATES; ++candidate) {
+                AABB candidate_box(Vec2D(0.0f, 0.0f), Vec2D(0.0f, 0.0f));
+                Vec2D candidate_velocity;
+                random_candidate(random, boxes.back(), velocities.back(), candidate_box, candidate_velocity);
+                candidates[box_index].add(candidate_box, candidate_velocity);
+            }
+        }
+
+        double pair_count = static_cast<double>(BENCHMARK_BOXES) * BENCHMARK_CANDIDATES * BENCHMARK_REPEATS;
+        std::vector<std::uint8_t> hits;
+        std::vector<float> first_contact;
+        std::size_t checksum = 0;
+
+        auto report = [&](const char* name, std::chrono::steady_clock::duration elapsed) {
+            double seconds = std::chrono::duration<double>(elapsed).count();
+            std::cout << "  " << name << ": " << (pair_count / seconds) / 1e6 << " Mpairs/s\n";
+        };
+
+        std::cout << "batch benchmark (" << BENCHMARK_BOXES << " boxes x " << BENCHMARK_CANDIDATES << " candidates x "
+            << BENCHMARK_REPEATS << " repeats):\n";
+
+        auto start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < BENCHMARK_REPEATS; ++repeat) {
+            for (int box_index = 0; box_index < BENCHMARK_BOXES; ++box_index) {
+                const Collider_Arrays& arrays = candidates[box_index];
+                for (std::size_t candidate = 0; candidate < arrays.size(); ++candidate) {
+                    AABB candidate_box(Vec2D(arrays.min_x[candidate], arrays.min_y[candidate]),
+                        Vec2D(arrays.max_x[candidate], arrays.max_y[candidate]));
+                    float contact = 0.0f;
+                    checksum += collision_intersection_pair(boxes[box_index], velocities[box_index], candidate_box,
+                        Vec2D(arrays.vel_x[candidate], arrays.vel_y[candidate]), contact, DELTA_TIME);
+                }
+            }
+        }
+        report("per pair", std::chrono::steady_clock::now() - start);
+
+        const Collision_Batch_Path paths[] = { Collision_Batch_Path::SCALAR, Collision_Batch_Path::SSE2, Collision_Batch_Path::AVX2 };
+        for (Collision_Batch_Path path : paths) {
+            if (!collision_batch_supported(path)) {
+                continue;
+            }
+            start = std::chrono::steady_clock::now();
+            for (int repeat = 0; repeat < BENCHMARK_REPEATS; ++repeat) {
+                for (int box_index = 0; box_index < BENCHMARK_BOXES; ++box_index) {
+                    collision_intersection_batch(boxes[box_index], velocities[box_index], candidates[box_index],
+                        DELTA_TIME, hits, first_contact, path);
+                    checksum += hits[0];
+                }
+            }
+            report(path_name(path), std::chrono::steady_clock::now() - start);
+        }
+
+        // Printed so the timed work is not optimized away
+        std::cout << "  checksum " << checksum << "\n";
+    }
+
+    /**
+     * @struct Scene
+     * @brief Boxes moving around a level for the broadphase tests, one entry per entity.
+     */
+    struct Scene {
+        std::vector<EntityID> entities;     ///< Entity of each box
+        std::vector<Vec2D> centers;         ///< Center of each box
+        std::vector<Vec2D> half_sizes;      ///< Half width and height of each box
+        std::vector<Vec2D> velocities;      ///< Velocity of each box, zero for tiles
+        std::vector<AABB> boxes;            ///< Box of each entity in the current frame
+    };
+
+    /**
+     * @brief Place a box of a scene, as a tile, a small moving box or a large slow box.
+     * @details Tiles sit on a grid at exact coordinates, so neighbouring tiles share edges. Large
+     *          boxes cover more cells than the spatial hash grids, so they take its fallback path.
+     */
+    void place_box(std::mt19937& random, Scene& scene, std::size_t index) {
+        std::uniform_real_distribution<float> position(0.0f, WORLD_SIZE);
+        std::uniform_real_distribution<float> size(4.0f, 32.0f);
+        std::uniform_real_distribution<float> speed(-150.0f, 150.0f);
+        std::uniform_int_distribution<int> tile(0, static_cast<int>(WORLD_SIZE / TILE_SIZE) - 1);
+        std::uniform_int_distribution<int> kind(0, 99);
+
+        int roll = kind(random);
+        if (roll < 25) {
+            scene.centers[index] = Vec2D((tile(random) + 0.5f) * TILE_SIZE, (tile(random) + 0.5f) * TILE_SIZE);
+            scene.half_sizes[index] = Vec2D(TILE_SIZE / 2.0f, TILE_SIZE / 2.0f);
+            scene.velocities[index] = Vec2D(0.0f, 0.0f);
+        }
+        else if (roll < 27) {
+            scene.centers[index] = Vec2D(position(random), position(random));
+            scene.half_sizes[index] = Vec2D(size(random) * 20.0f, size(random) * 20.0f);
+            scene.velocities[index] = Vec2D(speed(random) / 10.0f, speed(random) / 10.0f);
+        }
+        else {
+            scene.centers[index] = Vec2D(position(random), position(random));
+            scene.half_sizes[index] = Vec2D(size(random), size(random));
+            scene.velocities[index] = Vec2D(speed(random), speed(random));
+        }
+    }
+
+    /**
+     * @brief Refresh the boxes of a scene from its centers and sizes.
+     */
+    void update_boxes(Scene& scene) {
+        for (std::size_t index = 0; index < scene.entities.size(); ++index) {
+            const Vec2D& center = scene.centers[index];
+            const Vec2D& half_size = scene.half_sizes[index];
+            scene.boxes[index] = AABB(Vec2D(center.x - half_size.x, center.y - half_size.y),
+                Vec2D(center.x + half_size.x, center.y + half_size.y));
+        }
+    }
+
+    /**
+     * @brief Mark the boxes of a scene that never move, as Static_Tag would.
+     */
+    void static_mask(const Scene& scene, std::vector<bool>& is_static) {
+        is_static.resize(scene.entities.size());
+        for (std::size_t index = 0; index < scene.entities.size(); ++index) {
+            is_static[index] = scene.velocities[index].x == 0.0f && scene.velocities[index].y == 0.0f;
+        }
+    }
+
+    /**
+     * @brief Make a scene with a number of boxes, one entity slot each.
+     */
+    void make_scene(std::mt19937& random, std::size_t count, Scene& scene) {
+        scene.entities.resize(count);
+        scene.centers.resize(count);
+        scene.half_sizes.resize(count);
+        scene.velocities.resize(count);
+        scene.boxes.assign(count, AABB(Vec2D(0.0f, 0.0f), Vec2D(0.0f, 0.0f)));
+        for (std::size_t index = 0; index < count; ++index) {
+            scene.entities[index] = make_entity_id(static_cast<std::uint32_t>(index), 0);
+            place_box(random, scene, index);
+        }
+        update_boxes(scene);
+    }
+
+    /**
+     * @brief Advance a scene by a frame.
+     * @details Boxes move and bounce off the edges of the level. Two entries swap places every
+     *          frame, and every RESPAWN_INTERVAL frames some boxes are replaced by new entities in
+     *          the same slots, as the ECS_Manager reorders and reuses entities.
+     */
+    void step_scene(std::mt19937& random, int frame, Scene& scene) {
+        std::size_t count = scene.entities.size();
+        for (std::size_t index = 0; index < count; ++index) {
+            Vec2D& center = scene.centers[index];
+            Vec2D& velocity = scene.velocities[index];
+            center.x += velocity.x * DELTA_TIME;
+            center.y += velocity.y * DELTA_TIME;
+            if (center.x < 0.0f || center.x > WORLD_SIZE) {
+                velocity.x = -velocity.x;
+            }
+            if (center.y < 0.0f || center.y > WORLD_SIZE) {
+                velocity.y = -velocity.y;
+            }
+        }
+
+        std::uniform_int_distribution<std::size_t> entry(0, count - 1);
+        std::size_t a = entry(random);
+        std::size_t b = entry(random);
+        std::swap(scene.entities[a], scene.entities[b]);
+        std::swap(scene.centers[a], scene.centers[b]);
+        std::swap(scene.half_sizes[a], scene.half_sizes[b]);
+        std::swap(scene.velocities[a], scene.velocities[b]);
+
+        if (frame % RESPAWN_INTERVAL == 0) {
+            for (std::size_t respawn = 0; respawn < count / 50; ++respawn) {
+                std::size_t index = entry(random);
+                EntityID entity = scene.entities[index];
+                scene.entities[index] = make_entity_id(entity_index(entity), entity_generation(entity) + 1);
+                place_box(random, scene, index);
+            }
+        }
+        update_boxes(scene);
+    }
+
+    /**
+     * @brief Check if two boxes overlap, touching edges included, as the narrowphase's rejection test.
+     */
+    bool boxes_overlap(const AABB& a, const AABB& b) {
+        return !(a.max.x < b.min.x || a.min.x > b.max.x || a.max.y < b.min.y || a.min.y > b.max.y);
+    }
+
+    /**
+     * @brief Slab test of a segment against a box, written out per box as the reference for ray_cast().
+     * @return True if the segment passes through the box, with where it enters in fraction.
+     */
+    bool segment_hits_box(const Vec2D& start, const Vec2D& end, const AABB& box, float& fraction) {
+        float enter = 0.0f;
+        float exit = 1.0f;
+        const float starts[2] = { start.x, start.y };
+        const float directions[2] = { end.x - start.x, end.y - start.y };
+        const float mins[2] = { box.min.x, box.min.y };
+        const float maxs[2] = { box.max.x, box.max.y };
+        for (int axis = 0; axis < 2; ++axis) {
+            if (directions[axis] == 0.0f) {
+                if (starts[axis] < mins[axis] || starts[axis] > maxs[axis]) {
+                    return false;
+                }
+                continue;
+            }
+            float inverse = 1.0f / directions[axis];
+            float near_t = std::min((mins[axis] - starts[axis]) * inverse, (maxs[axis] - starts[axis]) * inverse);
+            float far_t = std::max((mins[axis] - starts[axis]) * inverse, (maxs[axis] - starts[axis]) * inverse);
+            enter = std::max(enter, near_t);
+            exit = std::min(exit, far_t);
+        }
+        fraction = enter;
+        return enter <= exit;
+    }
+
+    /**
+     * @brief Make a random box in a small area, on the tile grid for a quarter of them so edges touch.
+     */
+    AABB random_tree_box(std::mt19937& random) {
+        std::uniform_real_distribution<float> position(0.0f, 1024.0f);
+        std::uniform_real_distribution<float> size(2.0f, 48.0f);
+        std::uniform_int_distribution<int> tile(0, static_cast<int>(1024.0f / TILE_SIZE) - 1);
+        std::uniform_int_distribution<int> kind(0, 3);
+
+        if (kind(random) == 0) {
+            Vec2D min(tile(random) * TILE_SIZE, tile(random) * TILE_SIZE);
+            return AABB(min, Vec2D(min.x + TILE_SIZE, min.y + TILE_SIZE));
+        }
+        Vec2D min(position(random), position(random));
+        return AABB(min, Vec2D(min.x + size(random), min.y + size(random)));
+    }
+
+    /**
+     * @brief Compare box queries, pair queries and ray casts of an AABB tree against brute force.
+     * @details One tree is grown by proxies that move, leave and join every round, which exercises
+     *          insertion, removal and the balancing rotations. The other is built in one pass. Both
+     *          have no margin, so their results must match the exact boxes.
+     * @return The number of queries that got a wrong result.
+     */
+    int test_aabb_tree_matches() {
+        std::mt19937 random(RANDOM_SEED);
+        std::uniform_int_distribution<std::size_t> pick(0, TREE_TEST_BOXES - 1);
+        std::uniform_real_distribution<float> position(-64.0f, 1088.0f);
+        std::uniform_int_distribution<int> ray_kind(0, 3);
+
+        AABB_Tree dynamic_tree;
+        AABB_Tree static_tree;
+        std::vector<EntityID> entities(TREE_TEST_BOXES);
+        std::vector<AABB> boxes;
+        std::vector<std::int32_t> proxies(TREE_TEST_BOXES);
+        for (std::size_t index = 0; index < TREE_TEST_BOXES; ++index) {
+            entities[index] = make_entity_id(static_cast<std::uint32_t>(index), 0);
+            boxes.push_back(random_tree_box(random));
+            proxies[index] = dynamic_tree.create_proxy(entities[index], boxes[index]);
+        }
+
+        // The built tree's entities live in slots after the grown tree's
+        std::vector<EntityID> static_entities(TREE_TEST_BOXES);
+        std::vector<AABB> static_boxes;
+        for (std::size_t index = 0; index < TREE_TEST_BOXES; ++index) {
+            static_entities[index] = make_entity_id(static_cast<std::uint32_t>(TREE_TEST_BOXES + index), 0);
+            static_boxes.push_back(random_tree_box(random));
+        }
+        static_tree.build(static_entities, static_boxes);
+
+        std::vector<EntityID> found;
+        std::vector<EntityID> expected_found;
+        std::vector<Entity_Pair> pairs;
+        std::vector<Entity_Pair> expected_pairs;
+        std::vector<Ray_Hit> hits;
+        std::vector<Ray_Hit> expected_hits;
+        std::size_t checks = 0;
+        std::int32_t max_height = 0;
+        int mismatches = 0;
+
+        auto by_entity = [](const Ray_Hit& a, const Ray_Hit& b) { return a.entity < b.entity; };
+        auto report = [&](const char* what, int round) {
+            if (mismatches < 10) {
+                std::cout << "  round " << round << ": " << what << " differs\n";
+            }
+            ++mismatches;
+        };
+
+        for (int round = 0; round < TREE_TEST_ROUNDS; ++round) {
+            // Move some boxes, and replace others with new entities in the same slots
+            for (std::size_t change = 0; change < TREE_TEST_BOXES / 8; ++change) {
+                std::size_t index = pick(random);
+                boxes[index] = random_tree_box(random);
+                if (change % 4 == 0) {
+                    dynamic_tree.destroy_proxy(proxies[index]);
+                    entities[index] = make_entity_id(entity_index(entities[index]), entity_generation(entities[index]) + 1);
+                    proxies[index] = dynamic_tree.create_proxy(entities[index], boxes[index]);
+                }
+                else {
+                    dynamic_tree.move_proxy(proxies[index], boxes[index]);
+                }
+            }
+            max_height = std::max(max_height, dynamic_tree.get_height());
+
+            for (int query = 0; query < TREE_TEST_QUERIES; ++query) {
+                // Box queries against both trees
+                AABB box = random_tree_box(random);
+                for (int which = 0; which < 2; ++which) {
+                    const AABB_Tree& tree = which ? static_tree : dynamic_tree;
+                    const std::vector<EntityID>& tree_entities = which ? static_entities : entities;
+                    const std::vector<AABB>& tree_boxes = which ? static_boxes : boxes;
+
+                    found.clear();
+                    tree.query(box, found);
+                    expected_found.clear();
+                    for (std::size_t index = 0; index < tree_boxes.size(); ++index) {
+                        if (boxes_overlap(box, tree_boxes[index])) {
+                            expected_found.push_back(tree_entities[index]);
+                        }
+                    }
+                    std::sort(found.begin(), found.end());
+                    std::sort(expected_found.begin(), expected_found.end());
+                    if (found != expected_found) {
+                        report("box query", round);
+                    }
+
+                    // Ray casts, some along an axis or of zero length, against both trees
+                    Vec2D start(position(random), position(random));
+                    Vec2D end(position(random), position(random));
+                    switch (ray_kind(random)) {
+                    case 0:
+                        end.y = start.y;
+                        break;
+                    case 1:
+                        end.x = start.x;
+                        break;
+                    case 2:
+                        end = start;
+                        break;
+                    default:
+                        break;
+                    }
+
+                    tree.ray_cast(start, end, hits);
+                    bool nearest_first = std::is_sorted(hits.begin(), hits.end(),
+                        [](const Ray_Hit& a, const Ray_Hit& b) { return a.fraction < b.fraction; });
+                    expected_hits.clear();
+                    for (std::size_t index = 0; index < tree_boxes.size(); ++index) {
+                        float fraction = 0.0f;
+                        if (segment_hits_box(start, end, tree_boxes[index], fraction)) {
+                            expected_hits.push_back({ tree_entities[index], fraction });
+                        }
+                    }
+                    std::sort(hits.begin(), hits.end(), by_entity);
+                    std::sort(expected_hits.begin(), expected_hits.end(), by_entity);
+                    bool same_hits = hits.size() == expected_hits.size() &&
+                        std::equal(hits.begin(), hits.end(), expected_hits.begin(), [](const Ray_Hit& a, const Ray_Hit& b) {
+                            return a.entity == b.entity && bits_of(a.fraction) == bits_of(b.fraction);
+                        });
+                    if (!nearest_first || !same_hits) {
+                        report("ray cast", round);
+                    }
+                    checks += 2;
+                }
+            }
+
+            // Pairs within the grown tree, and between it and the built tree
+            pairs.clear();
+            dynamic_tree.query_pairs(pairs);
+            for (Entity_Pair& pair : pairs) {
+                pair = std::minmax(pair.first, pair.second);
+            }
+            expected_pairs.clear();
+            for (std::size_t a = 0; a < boxes.size(); ++a) {
+                for (std::size_t b = a + 1; b < boxes.size(); ++b) {
+                    if (boxes_overlap(boxes[a], boxes[b])) {
+                        expected_pairs.push_back(std::minmax(entities[a], entities[b]));
+                    }
+                }
+            }
+            std::sort(pairs.begin(), pairs.end());
+            std::sort(expected_pairs.begin(), expected_pairs.end());
+            if (pairs != expected_pairs) {
+                report("pair query", round);
+            }
+
+            pairs.clear();
+            dynamic_tree.query_pairs(static_tree, pairs);
+            expected_pairs.clear();
+            for (std::size_t a = 0; a < boxes.size(); ++a) {
+                for (std::size_t b = 0; b < static_boxes.size(); ++b) {
+                    if (boxes_overlap(boxes[a], static_boxes[b])) {
+                        expected_pairs.emplace_back(entities[a], static_entities[b]);
+                    }
+                }
+            }
+            std::sort(pairs.begin(), pairs.end());
+            std::sort(expected_pairs.begin(), expected_pairs.end());
+            if (pairs != expected_pairs) {
+                report("pair query between trees", round);
+            }
+            checks += 2;
+        }
+
+        std::cout << "AABB tree vs brute force: " << TREE_TEST_BOXES << " boxes, " << checks << " queries, height at most "
+            << max_height << ", " << mismatches << " mismatches\n";
+        return mismatches;
+    }
+
+    /**
+     * @brief Compare tile layer queries against every tile whose box overlaps.
+     * @details One level packs tiles on the tile grid, with touching edges, among tiles of other
+     *          sizes spanning several cells. The other spreads them so wide that the cell size has
+     *          to double to stay within MAX_TILE_LAYER_CELLS. Queries reach past the level's edges,
+     *          so the cells are clamped, and some touch a tile's edge exactly.
+     * @return The number of queries that missed a tile or listed one twice.
+     */
+    int test_tile_layer_matches() {
+        std::mt19937 random(RANDOM_SEED);
+        std::uniform_int_distribution<int> kind(0, 3);
+        std::uniform_int_distribution<std::size_t> pick(0, TILE_TEST_TILES - 1);
+        int mismatches = 0;
+
+        for (int wide = 0; wide < 2; ++wide) {
+            float spread = wide ? TILE_TEST_WIDE_SPREAD : 2048.0f;
+            std::uniform_real_distribution<float> position(0.0f, spread);
+            std::uniform_real_distribution<float> outside(-spread / 8.0f, spread * 9.0f / 8.0f);
+            std::uniform_real_distribution<float> size(4.0f, 200.0f);
+            std::uniform_real_distribution<float> query_size(1.0f, spread / 16.0f);
+            std::uniform_int_distribution<int> tile(0, static_cast<int>(2048.0f / TILE_SIZE) - 1);
+
+            std::vector<EntityID> entities;
+            std::vector<AABB> boxes;
+            for (std::size_t index = 0; index < TILE_TEST_TILES; ++index) {
+                entities.push_back(make_entity_id(static_cast<std::uint32_t>(index), 0));
+                if (!wide && kind(random) != 0) {
+                    Vec2D min(tile(random) * TILE_SIZE, tile(random) * TILE_SIZE);
+                    boxes.emplace_back(min, Vec2D(min.x + TILE_SIZE, min.y + TILE_SIZE));
+                }
+                else {
+                    Vec2D min(position(random), position(random));
+                    boxes.emplace_back(min, Vec2D(min.x + size(random), min.y + size(random)));
+                }
+            }
+
+            Tile_Layer layer;
+            layer.bake(entities, boxes);
+            bool doubled = layer.get_cell_size() > DEFAULT_TILE_SIZE;
+            if (doubled != (wide != 0)) {
+                std::cout << "  tile layer: cell size " << layer.get_cell_size() << " for a spread of " << spread << "\n";
+                ++mismatches;
+            }
+
+            std::vector<std::uint32_t> found;
+            std::size_t expected_count = 0;
+            std::size_t found_count = 0;
+            for (int query = 0; query < TILE_TEST_QUERIES; ++query) {
+                Vec2D min(outside(random), outside(random));
+                AABB box(min, Vec2D(min.x + query_size(random), min.y + query_size(random)));
+                if (kind(random) == 0) {
+                    // Touching a tile's right edge
+                    const AABB& other = boxes[pick(random)];
+                    box.max.x = box.max.x - box.min.x + other.max.x;
+                    box.min.x = other.max.x;
+                }
+
+                layer.query(box, found);
+                bool valid = std::adjacent_find(found.begin(), found.end(), std::greater_equal<std::uint32_t>()) == found.end() &&
+                    (found.empty() || found.back() < boxes.size());
+                for (std::uint32_t index = 0; valid && index < boxes.size(); ++index) {
+                    if (boxes_overlap(box, boxes[index])) {
+                        ++expected_count;
+                        valid = std::binary_search(found.begin(), found.end(), index);
+                    }
+                }
+                found_count += found.size();
+                if (!valid) {
+                    if (mismatches < 10) {
+                        std::cout << "  tile layer query " << query << (wide ? " (wide)" : "") << " missed a tile or listed one twice\n";
+                    }
+                    ++mismatches;
+                }
+            }
+
+            // The cell holding each tile's center is occupied
+            for (const AABB& tile_box : boxes) {
+                if (!layer.is_occupied(Vec2D((tile_box.min.x + tile_box.max.x) / 2.0f, (tile_box.min.y + tile_box.max.y) / 2.0f))) {
+                    ++mismatches;
+                }
+            }
+
+            std::cout << "tile layer vs brute force" << (wide ? " (wide)" : "") << ": " << TILE_TEST_TILES << " tiles, cell size "
+                << layer.get_cell_size() << ", " << expected_count << " overlaps, " << found_count << " found, "
+                << mismatches << " mismatches\n";
+        }
+        return mismatches;
+    }
+
+    /**
+     * @brief Compare the spatial hash, sweep and prune and AABB tree broadphases against every
+     *        overlapping pair over a moving scene.
+     * @details The AABB tree broadphase leaves out pairs of two static boxes. One frame moves a
+     *          static box in place and reports it, and the respawns give slots new generations.
+     * @return The number of frames any broadphase got wrong.
+     */
+    int test_broadphases_match() {
+        std::mt19937 random(RANDOM_SEED);
+        Scene scene;
+        make_scene(random, BROADPHASE_TEST_BOXES, scene);
+
+        Spatial_Hash spatial_hash;
+        Sweep_And_Prune sweep_and_prune;
+        Tree_Broadphase tree_broadphase;
+        std::vector<Candidate_Pair> all_pairs;
+        std::vector<Candidate_Pair> expected;
+        std::vector<Candidate_Pair> expected_moving;
+        std::vector<Candidate_Pair> hash_pairs;
+        std::vector<Candidate_Pair> sweep_pairs;
+        std::vector<Candidate_Pair> tree_pairs;
+        std::vector<bool> is_static;
+        std::size_t pair_count = 0;
+        int mismatches = 0;
+
+        for (int frame = 0; frame < BROADPHASE_TEST_FRAMES; ++frame) {
+            static_mask(scene, is_static);
+
+            // Move a tile by a whole tile in place, which only the caller can report
+            bool statics_moved = false;
+            if (frame == STATIC_MOVE_FRAME) {
+                auto tile = std::find(is_static.begin(), is_static.end(), true);
+                std::size_t index = static_cast<std::size_t>(tile - is_static.begin());
+                scene.centers[index].x += TILE_SIZE;
+                update_boxes(scene);
+                statics_moved = true;
+            }
+
+            // Every pair whose boxes pass the narrowphase's overlap test, touching edges included
+            find_pairs_brute_force(scene.boxes, all_pairs);
+            expected.clear();
+            for (const Candidate_Pair& pair : all_pairs) {
+                const AABB& a = scene.boxes[pair.first];
+                const AABB& b = scene.boxes[pair.second];
+                if (!(a.max.x < b.min.x || a.min.x > b.max.x || a.max.y < b.min.y || a.min.y > b.max.y)) {
+                    expected.push_back(pair);
+                }
+            }
+            expected_moving.clear();
+            for (const Candidate_Pair& pair : expected) {
+                if (!is_static[pair.first] || !is_static[pair.second]) {
+                    expected_moving.push_back(pair);
+                }
+            }
+            pair_count += expected.size();
+
+            spatial_hash.find_pairs(scene.boxes, hash_pairs);
+            sweep_and_prune.find_pairs(scene.entities, scene.boxes, sweep_pairs);
+            tree_broadphase.find_pairs(scene.entities, scene.boxes, is_static, statics_moved, tree_pairs);
+            bool hash_differs = hash_pairs != expected;
+            bool sweep_differs = sweep_pairs != expected;
+            bool tree_differs = tree_pairs != expected_moving;
+            if (hash_differs || sweep_differs || tree_differs) {
+                if (mismatches < 10) {
+                    std::cout << "  frame " << frame << ": " << expected.size() << " pairs expected, spatial hash found "
+                        << hash_pairs.size() << ", sweep and prune found " << sweep_pairs.size() << ", "
+                        << expected_moving.size() << " with a moving box expected, AABB tree found " << tree_pairs.size() << "\n";
+                }
+                ++mismatches;
+            }
+
+            step_scene(random, frame + 1, scene);
+        }
+
+        std::cout << "broadphases vs brute force: " << BROADPHASE_TEST_BOXES << " boxes, " << BROADPHASE_TEST_FRAMES
+            << " frames, " << pair_count << " pairs, " << mismatches << " mismatched frames\n";
+        return mismatches;
+    }
+
+    /**
+     * @brief Time the spatial hash, sweep and prune and AABB tree broadphases over the same moving scene.
+     */
+    void benchmark_broadphases() {
+        std::mt19937 random(RANDOM_SEED);
+        Scene scene;
+        make_scene(random, BROADPHASE_BENCHMARK_BOXES, scene);
+
+        // Record every frame first, so every broadphase sees the same boxes and only they are timed
+        std::vector<Scene> frames;
+        std::vector<std::vector<bool>> static_masks(BROADPHASE_BENCHMARK_FRAMES);
+        for (int frame = 0; frame < BROADPHASE_BENCHMARK_FRAMES; ++frame) {
+            frames.push_back(scene);
+            static_mask(scene, static_masks[frame]);
+            step_scene(random, frame + 1, scene);
+        }
+
+        Spatial_Hash spatial_hash;
+        Sweep_And_Prune sweep_and_prune;
+        Tree_Broadphase tree_broadphase;
+        std::vector<Candidate_Pair> pairs;
+        std::size_t hash_pairs = 0;
+        std::size_t sweep_pairs = 0;
+        std::size_t tree_pairs = 0;
+
+        auto report = [&](const char* name, std::chrono::steady_clock::duration elapsed, std::size_t pair_count) {
+            double seconds = std::chrono::duration<double>(elapsed).count();
+            std::cout << "  " << name << ": " << (seconds * 1e3) / BROADPHASE_BENCHMARK_FRAMES << " ms/frame, "
+                << (pair_count / seconds) / 1e6 << " Mpairs/s, "
+                << pair_count / BROADPHASE_BENCHMARK_FRAMES << " pairs/frame\n";
+        };
+
+        std::cout << "broadphase benchmark (" << BROADPHASE_BENCHMARK_BOXES << " boxes x " << BROADPHASE_BENCHMARK_FRAMES << " frames):\n";
+
+        auto start = std::chrono::steady_clock::now();
+        for (const Scene& frame : frames) {
+            spatial_hash.find_pairs(frame.boxes, pairs);
+            hash_pairs += pairs.size();
+        }
+        report("spatial hash", std::chrono::steady_clock::now() - start, hash_pairs);
+
+        start = std::chrono::steady_clock::now();
+        for (const Scene& frame : frames) {
+            sweep_and_prune.find_pairs(frame.entities, frame.boxes, pairs);
+            sweep_pairs += pairs.size();
+        }
+        report("sweep and prune", std::chrono::steady_clock::now() - start, sweep_pairs);
+
+        // Pairs of two static boxes are left out, so the tree reports fewer pairs
+        start = std::chrono::steady_clock::now();
+        for (std::size_t frame = 0; frame < frames.size(); ++frame) {
+            tree_broadphase.find_pairs(frames[frame].entities, frames[frame].boxes, static_masks[frame], false, pairs);
+            tree_pairs += pairs.size();
+        }
+        report("AABB tree", std::chrono::steady_clock::now() - start, tree_pairs);
+    }
+}
+
+int main() {
+    int failures = 0;
+    failures += test_batch_matches_pair();
+    failures += test_aabb_tree_matches();
+    failures += test_broadphases_match();
+    failures += test_tile_layer_matches();
+
+    benchmark_batch();
+    benchmark_broadphases();
+
+    std::cout << (failures ? "FAILED" : "PASSED") << "\n";
+    return failures ? 1 : 0;
+}
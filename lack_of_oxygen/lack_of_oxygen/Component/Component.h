@@ -27,6 +27,9 @@
 //#include "../Utility/Path_Helper.h"
 // #include "../Utility/Path_Helper.h"
 #include "../Utility/Force_Helper.h"
+#include "../Utility/Type_List.h"
+#include "../Utility/Type.h"
+#include "../Utility/Shared_Value.h"
 #include "../Manager/Log_Manager.h"
 // FOR TESTING 
 #include "../Glad/glad.h"
@@ -256,16 +259,17 @@ namespace lof {
     */
     class Graphics_Component : public Component {
     public:
-        std::string model_name;
+        Shared_Value<std::string> model_name;   // Shared with clones of the same prefab until written
         glm::vec3 color;
-        std::string texture_name;
+        Shared_Value<std::string> texture_name; // Shared with clones of the same prefab until written
         GLuint shd_ref;
         glm::mat3 mdl_to_ndc_xform;
+        glm::mat3 mdl_to_world_xform; // Cached by the Render_System, rebuilt only when the transform changes
 
         // Default constructor
         Graphics_Component()
             : model_name(DEFAULT_MODEL_NAME), color(DEFAULT_COLOR), texture_name(DEFAULT_TEXTURE_NAME), 
-              shd_ref(DEFAULT_SHADER_REF), mdl_to_ndc_xform(DEFAULT_MDL_TO_NDC_MAT) {}
+              shd_ref(DEFAULT_SHADER_REF), mdl_to_ndc_xform(DEFAULT_MDL_TO_NDC_MAT), mdl_to_world_xform(DEFAULT_MDL_TO_NDC_MAT) {}
 
         /**
          * @brief Constructor for Graphics_Component.
@@ -277,7 +281,7 @@ namespace lof {
          */
 
         Graphics_Component(std::string mdl_name, glm::vec3 clr, std::string tex_name, GLuint shader, glm::mat3 xform) :
-            model_name(mdl_name), color(clr), texture_name(tex_name), shd_ref(shader), mdl_to_ndc_xform(xform) {}
+            model_name(mdl_name), color(clr), texture_name(tex_name), shd_ref(shader), mdl_to_ndc_xform(xform), mdl_to_world_xform(DEFAULT_MDL_TO_NDC_MAT) {}
 
     };
 
@@ -287,14 +291,14 @@ namespace lof {
     */
     class Animation_Component : public Component {
     public:
-        std::map<std::string, std::string> animations; 
+        Shared_Value<std::map<std::string, std::string>> animations; // Shared with clones of the same prefab until written
         unsigned int curr_animation_idx;
         unsigned int start_animation_idx;
 
         // Default constructor
         Animation_Component()
             : curr_animation_idx(std::stoi(DEFAULT_ANIMATION_IDX)), start_animation_idx(std::stoi(DEFAULT_ANIMATION_IDX)) {
-            animations.insert(std::make_pair(DEFAULT_ANIMATION_IDX, DEFAULT_ANIMATION_NAME));
+            animations.write().insert(std::make_pair(DEFAULT_ANIMATION_IDX, DEFAULT_ANIMATION_NAME));
         }
 
         /**
@@ -306,7 +310,18 @@ namespace lof {
 
         Animation_Component(std::pair<std::string, std::string> animation, int curr_animation, int start_animation) :
             curr_animation_idx(curr_animation), start_animation_idx(start_animation) {
-            animations.insert(animation);
+            animations.write().insert(animation);
+        }
+
+        /**
+         * @brief Get the name of the animation at an index.
+         * @param index The animation index.
+         * @return The animation name, or an empty string if the index has no animation.
+         */
+        const std::string& get_animation_name(unsigned int index) const {
+            static const std::string no_animation;
+            auto it = animations->find(std::to_string(index));
+            return it != animations->end() ? it->second : no_animation;
         }
     };
 
@@ -651,7 +666,7 @@ namespace lof {
     */
     class Text_Component : public Component {
     public:
-        std::string font_name;
+        Shared_Value<std::string> font_name;    // Shared with clones of the same prefab until written
         std::string text;
         glm::vec3 color;
 
@@ -670,6 +685,94 @@ namespace lof {
 
     };
 
+    /**
+     * @class Hierarchy_Component
+     * @brief Links an entity to its parent and children, and caches its world transform.
+     * @details The Transform2D of an entity with a parent is relative to that parent. Children
+     *          inherit their parent's position and rotation but not its scale, so a child's scale
+     *          stays in world units. Links are managed by ECS_Manager::set_parent() and
+     *          ECS_Manager::remove_parent(), and the cached matrices by the Hierarchy_System.
+     */
+    class Hierarchy_Component : public Component {
+    public:
+        EntityID parent;        ///< Parent entity, INVALID_ENTITY_ID for a root
+        EntityID first_child;   ///< First child, INVALID_ENTITY_ID if the entity has no children
+        EntityID next_sibling;  ///< Next child of the same parent, INVALID_ENTITY_ID for the last child
+        glm::mat3 node_xform;   ///< Cached local-to-world transform without scale, passed on to children
+        glm::mat3 world_xform;  ///< Cached model-to-world transform including the entity's scale
+
+        Hierarchy_Component()
+            : parent(INVALID_ENTITY_ID)
+            , first_child(INVALID_ENTITY_ID)
+            , next_sibling(INVALID_ENTITY_ID)
+            , node_xform(1.0f)
+            , world_xform(1.0f) {}
+    };
+
+    /**
+     * @struct Player_Tag
+     * @brief Tag marking the player entity.
+     * @details Systems find the player with ECS_Manager::get_singleton<Player_Tag>() instead of
+     *          looking up its name every frame. Tags do not derive from Component so that they
+     *          stay empty and their pools store no values.
+     */
+    struct Player_Tag {};
+
+    /**
+     * @struct Static_Tag
+     * @brief Tag marking an entity whose Physics_Component is static.
+     * @details Kept in step with Physics_Component::is_static by whoever sets the flag, so systems
+     *          can exclude static entities in their signature instead of testing the flag per entity.
+     */
+    struct Static_Tag {};
+
+    /**
+     * @struct Background_Tag
+     * @brief Tag marking the scene background, which always renders filled and without debug overlays.
+     */
+    struct Background_Tag {};
+
+    /**
+     * @struct Tile_Tag
+     * @brief Tag marking a static collider baked into the Collision_System's tile layer.
+     * @details Added and removed by Collision_System::bake_tile_layer(). The Collision_System excludes
+     *          tagged entities and tests moving bodies against the tile layer instead, so level
+     *          geometry stays out of its per-frame loops.
+     */
+    struct Tile_Tag {};
+
+    /**
+     * @typedef Component_List
+     * @brief Every component type used by the ECS. A type's position in the list is its component ID.
+     * @details New component types must be appended here before they can be registered.
+     */
+    using Component_List = Type_List<
+        Transform2D,
+        Velocity_Component,
+        Collision_Component,
+        Physics_Component,
+        Graphics_Component,
+        Audio_Component,
+        GUI_Component,
+        Animation_Component,
+        Logic_Component,
+        Text_Component,
+        Hierarchy_Component,
+        Player_Tag,
+        Static_Tag,
+        Background_Tag,
+        Tile_Tag
+    >;
+
+    static_assert(Component_List::size <= MAX_COMPONENTS, "Exceeded maximum number of components.");
+
+    /**
+     * @brief Compile-time component ID of a component type.
+     * @tparam T The component type, which must be in Component_List.
+     */
+    template<typename T>
+    constexpr std::size_t component_type_id = Type_List_Index<T, Component_List>::value;
+
 } // namespace lof
 
 #endif // LOF_COMPONENT_H
@@ -0,0 +1,364 @@
+/**
+ * @file Component_Pool.h
+ * @brief Defines the Component_Pool class template for contiguous component storage in the ECS.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_COMPONENT_POOL_H
+#define LOF_COMPONENT_POOL_H
+
+// Include standard headers
+#include <vector>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+#include <cassert> // For assert
+
+// Include other necessary headers
+#include "../Utility/Type.h" // For EntityID
+
+namespace lof {
+
+    /**
+     * @class Component_Pool_Base
+     * @brief Type-erased interface so the ECS_Manager can operate on every pool without knowing its type.
+     */
+    class Component_Pool_Base {
+    public:
+        /**
+         * @brief Virtual destructor for the Component_Pool_Base class.
+         */
+        virtual ~Component_Pool_Base() = default;
+
+        /**
+         * @brief Check if the pool holds a component for an entity.
+         * @param entity The ID of the entity to check.
+         * @return True if the entity has a component in this pool, false otherwise.
+         */
+        virtual bool has(EntityID entity) const = 0;
+
+        /**
+         * @brief Remove the component of an entity from the pool, if any.
+         * @param entity The ID of the entity whose component is removed.
+         */
+        virtual void remove(EntityID entity) = 0;
+
+        /**
+         * @brief Get the number of components stored in the pool.
+         * @return The number of packed components.
+         */
+        virtual std::size_t size() const = 0;
+
+        /**
+         * @brief Remove every component from the pool.
+         */
+        virtual void clear() = 0;
+
+        /**
+         * @brief Reserve capacity in the pool.
+         * @param capacity The number of components to reserve space for.
+         */
+        virtual void reserve(std::size_t capacity) = 0;
+
+        /**
+         * @brief Copy the component of one entity onto another, replacing any existing component.
+         * @param source The ID of the entity whose component is copied, which must have one.
+         * @param destination The ID of the entity receiving the copy.
+         */
+        virtual void copy(EntityID source, EntityID destination) = 0;
+
+        /**
+         * @brief Rearrange the packed components to follow a given entity order.
+         * @details Components of entities listed in order come first, in that order, and the rest
+         *          follow in their current relative order. Invalidates references into the pool.
+         * @param order The preferred order of entity IDs.
+         */
+        virtual void reorder(const std::vector<EntityID>& order) = 0;
+
+        /**
+         * @brief Set the counter used to stamp component changes.
+         * @param tick Pointer to the owning ECS_Manager's change tick, which must outlive the pool.
+         */
+        void set_change_tick(const std::uint32_t* tick) {
+            change_tick = tick;
+        }
+
+        /**
+         * @brief Stamp the component of an entity as changed at the current tick.
+         * @param entity The ID of the entity, which must have a component in this pool.
+         */
+        virtual void mark_dirty(EntityID entity) = 0;
+
+        /**
+         * @brief Get the tick at which the component of an entity last changed.
+         * @param entity The ID of the entity, which must have a component in this pool.
+         * @return The change tick of the entity's component.
+         */
+        virtual std::uint32_t get_version(EntityID entity) const = 0;
+
+        /**
+         * @brief Check if the component of an entity changed after a given tick.
+         * @param entity The ID of the entity, which must have a component in this pool.
+         * @param tick The tick to compare against, usually the tick at which the caller last ran.
+         * @return True if the component was added or written after the tick, false otherwise.
+         */
+        bool changed_since(EntityID entity, std::uint32_t tick) const {
+            return get_version(entity) > tick;
+        }
+
+    protected:
+        const std::uint32_t* change_tick = nullptr; ///< Current change tick of the owning ECS_Manager
+
+        /**
+         * @brief Get the tick to stamp changes with.
+         * @return The current change tick, or 0 if the pool is not owned by an ECS_Manager.
+         */
+        std::uint32_t current_tick() const {
+            return change_tick ? *change_tick : 0;
+        }
+    };
+
+    /**
+     * @class Component_Pool
+     * @brief Stores components of type T contiguously.
+     * @details Components live in a packed (dense) array, with a parallel array of owning entities
+     *          and a sparse map from entity slot index to packed index. Lookups are a single index
+     *          into the sparse map and iteration over the dense array is linear in memory. A lookup
+     *          only succeeds when the stored owner matches the full ID, so stale handles whose
+     *          slot has been recycled are rejected. Removal swaps the last component
+     *          into the freed slot, so references returned by get() are only valid until the next
+     *          insert() or remove() on the same pool. Every component carries the tick at which it
+     *          was last inserted or accessed through the mutable get(), so systems can skip
+     *          entities whose data has not changed. Read-only code should use read() to
+     *          avoid marking components as changed. Empty types are tags: the pool only tracks
+     *          which entities own one, and every lookup returns the same shared instance.
+     * @tparam T The component type stored in the pool.
+     */
+    template<typename T>
+    class Component_Pool : public Component_Pool_Base {
+    public:
+        static constexpr std::size_t INVALID_INDEX = std::numeric_limits<std::size_t>::max();
+        static constexpr bool IS_TAG = std::is_empty_v<T>;
+
+    private:
+        inline static T tag_value{};              ///< Shared value of every tag, tags have no state to store
+        std::vector<T> components;                ///< Packed component values, always empty for tags
+        std::vector<EntityID> dense_entities;     ///< Owning entity of each packed component
+        std::vector<std::size_t> entity_to_index; ///< Entity slot index to index into the packed arrays
+        std::vector<std::uint32_t> versions;      ///< Change tick of each packed component
+
+    public:
+        /**
+         * @brief Insert or replace the component of an entity.
+         * @param entity The ID of the entity receiving the component.
+         * @param component The component value to store.
+         * @return Reference to the stored component.
+         */
+        T& insert(EntityID entity, T component) {
+            std::uint32_t slot = entity_index(entity);
+            if (slot >= entity_to_index.size()) {
+                entity_to_index.resize(static_cast<std::size_t>(slot) + 1, INVALID_INDEX);
+            }
+
+            std::size_t index = entity_to_index[slot];
+            if (index != INVALID_INDEX) {
+                // Replace the component, taking ownership from any stale handle of the same slot
+                dense_entities[index] = entity;
+                versions[index] = current_tick();
+                if constexpr (IS_TAG) {
+                    return tag_value;
+                }
+                else {
+                    components[index] = std::move(component);
+                    return components[index];
+                }
+            }
+
+            entity_to_index[slot] = dense_entities.size();
+            dense_entities.push_back(entity);
+            versions.push_back(current_tick());
+            if constexpr (IS_TAG) {
+                return tag_value;
+            }
+            else {
+                components.push_back(std::move(component));
+                return components.back();
+            }
+        }
+
+        void remove(EntityID entity) override {
+            if (!has(entity)) {
+                return;
+            }
+
+            // Move the last component into the freed slot to keep the array packed
+            std::uint32_t slot = entity_index(entity);
+            std::size_t index = entity_to_index[slot];
+            std::size_t last = dense_entities.size() - 1;
+            if (index != last) {
+                if constexpr (!IS_TAG) {
+                    components[index] = std::move(components[last]);
+                }
+                dense_entities[index] = dense_entities[last];
+                versions[index] = versions[last];
+                entity_to_index[entity_index(dense_entities[index])] = index;
+            }
+
+            if constexpr (!IS_TAG) {
+                components.pop_back();
+            }
+            dense_entities.pop_back();
+            versions.pop_back();
+            entity_to_index[slot] = INVALID_INDEX;
+        }
+
+        bool has(EntityID entity) const override {
+            std::uint32_t slot = entity_index(entity);
+            return slot < entity_to_index.size() && entity_to_index[slot] != INVALID_INDEX &&
+                dense_entities[entity_to_index[slot]] == entity;
+        }
+
+        /**
+         * @brief Get the component of an entity for writing, stamping it as changed.
+         * @param entity The ID of the entity.
+         * @return Reference to the entity's component.
+         */
+        T& get(EntityID entity) {
+            assert(has(entity) && "Component not found on entity.");
+            std::size_t index = entity_to_index[entity_index(entity)];
+            versions[index] = current_tick();
+            if constexpr (IS_TAG) {
+                return tag_value;
+            }
+            else {
+                return components[index];
+            }
+        }
+
+        /**
+         * @brief Get the component of an entity.
+         * @param entity The ID of the entity.
+         * @return Constant reference to the entity's component.
+         */
+        const T& get(EntityID entity) const {
+            return read(entity);
+        }
+
+        /**
+         * @brief Get the component of an entity for reading, without stamping it as changed.
+         * @param entity The ID of the entity.
+         * @return Constant reference to the entity's component.
+         */
+        const T& read(EntityID entity) const {
+            assert(has(entity) && "Component not found on entity.");
+            if constexpr (IS_TAG) {
+                return tag_value;
+            }
+            else {
+                return components[entity_to_index[entity_index(entity)]];
+            }
+        }
+
+        void mark_dirty(EntityID entity) override {
+            assert(has(entity) && "Component not found on entity.");
+            versions[entity_to_index[entity_index(entity)]] = current_tick();
+        }
+
+        std::uint32_t get_version(EntityID entity) const override {
+            assert(has(entity) && "Component not found on entity.");
+            return versions[entity_to_index[entity_index(entity)]];
+        }
+
+        std::size_t size() const override {
+            return dense_entities.size();
+        }
+
+        void clear() override {
+            components.clear();
+            dense_entities.clear();
+            entity_to_index.clear();
+            versions.clear();
+        }
+
+        void reserve(std::size_t capacity) override {
+            if constexpr (!IS_TAG) {
+                components.reserve(capacity);
+            }
+            dense_entities.reserve(capacity);
+            versions.reserve(capacity);
+        }
+
+        void copy(EntityID source, EntityID destination) override {
+            insert(destination, read(source));
+        }
+
+        void reorder(const std::vector<EntityID>& order) override {
+            // Packed index each new position takes its component from
+            std::vector<std::size_t> sources;
+            sources.reserve(dense_entities.size());
+            std::vector<char> placed(dense_entities.size(), 0);
+            for (EntityID entity : order) {
+                if (has(entity)) {
+                    std::size_t index = entity_to_index[entity_index(entity)];
+                    sources.push_back(index);
+                    placed[index] = 1;
+                }
+            }
+            for (std::size_t i = 0; i < dense_entities.size(); ++i) {
+                if (!placed[i]) {
+                    sources.push_back(i);
+                }
+            }
+
+            std::vector<EntityID> sorted_entities;
+            std::vector<std::uint32_t> sorted_versions;
+            sorted_entities.reserve(sources.size());
+            sorted_versions.reserve(sources.size());
+            for (std::size_t index : sources) {
+                sorted_entities.push_back(dense_entities[index]);
+                sorted_versions.push_back(versions[index]);
+            }
+            if constexpr (!IS_TAG) {
+                std::vector<T> sorted_components;
+                sorted_components.reserve(sources.size());
+                for (std::size_t index : sources) {
+                    sorted_components.push_back(std::move(components[index]));
+                }
+                components.swap(sorted_components);
+            }
+            dense_entities.swap(sorted_entities);
+            versions.swap(sorted_versions);
+
+            for (std::size_t i = 0; i < dense_entities.size(); ++i) {
+                entity_to_index[entity_index(dense_entities[i])] = i;
+            }
+        }
+
+        /**
+         * @brief Get the packed component array.
+         * @details Writes through this array are not stamped, call mark_dirty() for changed components.
+         *          The array is always empty for tags.
+         * @return Reference to the packed components, in the same order as get_entities().
+         */
+        std::vector<T>& get_components() {
+            return components;
+        }
+
+        /**
+         * @brief Get the owning entity of each packed component.
+         * @return Constant reference to the packed entity IDs.
+         */
+        const std::vector<EntityID>& get_entities() const {
+            return dense_entities;
+        }
+    };
+
+} // namespace lof
+
+#endif // LOF_COMPONENT_POOL_H
@@ -18,6 +18,9 @@
 #include <iostream>
 #include <iomanip>    // For std::fixed and std::setprecision
 #include <sstream>    // For std::stringstream
+#include <cstring>    // For std::strcmp
+#include <algorithm>  // For std::sort
+#include <utility>    // For std::pair
 
 // Include for memory leaks
 #define _CRTDBG_MAP_ALLOC
@@ -29,8 +32,65 @@ using namespace lof;
 bool level_editor_mode = false;
 GLFWwindow* window = nullptr;
 
+/**
+ * @brief Update two headless worlds loaded with the first scene, each on its own thread.
+ * @details Both worlds start from the same scene and are updated with the same time steps, so
+ *          they must end with the same transforms unless they share simulation state.
+ * @return True if both worlds ended with the same transforms, false otherwise.
+ */
+static bool check_worlds() {
+    std::string scene_path = ASM.get_full_path("Scenes", "scene1.scn");
+    World first_world;
+    World second_world;
+    if (!first_world.is_started() || !second_world.is_started() ||
+        !first_world.load_scene(scene_path) || !second_world.load_scene(scene_path)) {
+        LM.write_log("check_worlds(): Failed to load %s into both worlds.", scene_path.c_str());
+        return false;
+    }
+
+    auto simulate = [](World& world) {
+        for (int frame = 0; frame < DEFAULT_CHECK_WORLDS_FRAMES; ++frame) {
+            world.update(DEFAULT_CHECK_WORLDS_DELTA_TIME);
+        }
+    };
+    std::thread first_thread(simulate, std::ref(first_world));
+    std::thread second_thread(simulate, std::ref(second_world));
+    first_thread.join();
+    second_thread.join();
+
+    // Pools may have been sorted differently, so compare the transforms in entity order
+    auto positions_of = [](World& world) {
+        return world.run([](ECS_Manager& ecs) {
+            const auto& transform_pool = ecs.get_component_pool<Transform2D>();
+            std::vector<std::pair<EntityID, Vec2D>> positions;
+            for (EntityID entity_id : transform_pool.get_entities()) {
+                positions.emplace_back(entity_id, transform_pool.read(entity_id).position);
+            }
+            std::sort(positions.begin(), positions.end(), [](const auto& a, const auto& b) {
+                return a.first < b.first;
+            });
+            return positions;
+        });
+    };
+    std::vector<std::pair<EntityID, Vec2D>> first_positions = positions_of(first_world);
+    std::vector<std::pair<EntityID, Vec2D>> second_positions = positions_of(second_world);
+
+    bool same = first_positions.size() == second_positions.size();
+    for (std::size_t i = 0; same && i < first_positions.size(); ++i) {
+        same = first_positions[i].first == second_positions[i].first &&
+            first_positions[i].second.x == second_positions[i].second.x &&
+            first_positions[i].second.y == second_positions[i].second.y;
+    }
 
-int main(void) {
+    LM.write_log("check_worlds(): Updated 2 worlds of %zu entities for %d frames, transforms %s.",
+        first_positions.size(), DEFAULT_CHECK_WORLDS_FRAMES, same ? "match" : "differ");
+    std::cout << "World check " << (same ? "passed" : "failed") << ": " << first_positions.size()
+        << " entities, " << DEFAULT_CHECK_WORLDS_FRAMES << " frames." << std::endl;
+    return same;
+}
+
+
+int main(int argc, char* argv[]) {
 
     // --------------------------- Initialization ---------------------------
 
@@ -107,6 +167,17 @@ int main(void) {
         std::cout << "Game_Manager started up successfully." << std::endl;
     }
 
+    // Run the headless world check instead of the game when asked to
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], CHECK_WORLDS_OPTION) == 0) {
+            bool passed = check_worlds();
+            GM.shut_down();
+            glfwDestroyWindow(window);
+            glfwTerminate();
+            return passed ? 0 : 1;
+        }
+    }
+
     // --------------------------- Start IMGUI_Manager ---------------------------
 
     IMGUIM.start_up(window); // Might need to integrate with game manager 
@@ -187,6 +258,12 @@ int main(void) {
         bool is_TAB_pressed = IM.is_key_held(GLFW_KEY_TAB);
         if (IM.is_key_pressed(GLFW_KEY_TAB) && !tab_key_was_pressed_last_frame) {
             level_editor_mode = !level_editor_mode;
+
+            // Level geometry may have been edited, so bake it again before the game resumes
+            Collision_System* collision_system = ECSM.get_system<Collision_System>();
+            if (!level_editor_mode && collision_system) {
+                collision_system->bake_tile_layer();
+            }
         }
         tab_key_was_pressed_last_frame = is_TAB_pressed;
      
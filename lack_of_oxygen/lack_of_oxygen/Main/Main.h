@@ -24,6 +24,7 @@
 #include "../Component/Component.h"
 #include "../System/System.h"
 #include "../System/Movement_System.h"
+#include "../System/Collision_System.h"
 #include "../Manager/ECS_Manager.h"
 
 // Include Utility headers
@@ -39,6 +40,8 @@
 #include "../Manager/Serialization_Manager.h"
 #include "../Manager/Graphics_Manager.h"
 #include "../Manager/IMGUI_Manager.h"
+#include "../Manager/Assets_Manager.h"
+#include "../Manager/World.h"
 
 #include "../IMGUI/imgui.h"
 #include "../IMGUI/imgui_impl_glfw.h"
@@ -23,6 +23,7 @@
 #include "../System/Audio_System.h"
 #include "../System/Animation_System.h"
 #include "../System/Logic_System.h"
+#include "../System/Hierarchy_System.h"
 
 // Include Entity.h
 #include "../Entity/Entity.h"
@@ -31,23 +32,43 @@
 #include "../Utility/Type.h" // Include shared types
 #include "../Utility/Component_Parser.h" // Include Component_Parser for adding components from JSON
 #include "../Utility/Globals.h"
+#include "../Utility/Morton.h"
 
 // Include Log_Manager for logging
 #include "Log_Manager.h"
 
+// Include Job_Manager for running systems concurrently
+#include "Job_Manager.h"
+
 // Include standard headers
 #include <algorithm>
 #include <cassert>
+#include <charconv>
 #include <chrono>
+#include <numeric>
 
 namespace lof {
 
+    namespace {
+        // Instance ECSM resolves to on this thread, nullptr for the process-wide instance
+        thread_local ECS_Manager* bound_instance = nullptr;
+    }
+
     // Initialize static members
     ECS_Manager& ECS_Manager::get_instance() {
+        if (bound_instance) {
+            return *bound_instance;
+        }
         static ECS_Manager instance;
         return instance;
     }
 
+    ECS_Manager* ECS_Manager::bind(ECS_Manager* ecs) {
+        ECS_Manager* previous = bound_instance;
+        bound_instance = ecs;
+        return previous;
+    }
+
 
     ECS_Manager::ECS_Manager() {
         set_type("ECS_Manager");
@@ -95,26 +116,59 @@ namespace lof {
             register_component<Text_Component>();
             LM.write_log("ECS_Manager::start_up(): Registered component 'Text_Component'.");
 
+            register_component<Hierarchy_Component>();
+            LM.write_log("ECS_Manager::start_up(): Registered component 'Hierarchy_Component'.");
+
+            register_component<Player_Tag>();
+            LM.write_log("ECS_Manager::start_up(): Registered component 'Player_Tag'.");
+
+            register_component<Static_Tag>();
+            LM.write_log("ECS_Manager::start_up(): Registered component 'Static_Tag'.");
+
+            register_component<Background_Tag>();
+            LM.write_log("ECS_Manager::start_up(): Registered component 'Background_Tag'.");
+
+            register_component<Tile_Tag>();
+            LM.write_log("ECS_Manager::start_up(): Registered component 'Tile_Tag'.");
+
             // Register all systems used in the game
             LM.write_log("ECS_Manager::start_up(): Adding systems.");
 
-            add_system(std::make_unique<Collision_System>());
+            // Without rendering there is no cursor to pick entities with
+            auto collision_system = std::make_unique<Collision_System>();
+            collision_system->set_picking(render_enabled);
+            add_system(std::move(collision_system));
             LM.write_log("ECS_Manager::start_up(): Added system 'Collision_System'.");
 
-            add_system(std::make_unique<Movement_System>());
+            // Integration only touches each entity's own components, so it is split across workers
+            auto movement_system = std::make_unique<Movement_System>();
+            movement_system->set_parallel(true);
+            add_system(std::move(movement_system));
             LM.write_log("ECS_Manager::start_up(): Added system 'Movement_System'.");
 
-            add_system(std::make_unique<Render_System>());
-            LM.write_log("ECS_Manager::start_up(): Added system 'Render_System'.");
+            add_system(std::make_unique<Hierarchy_System>());
+            LM.write_log("ECS_Manager::start_up(): Added system 'Hierarchy_System'.");
+
+            if (render_enabled) {
+                // Only the matrix updates are split across workers, drawing stays on the main thread
+                auto render_system = std::make_unique<Render_System>();
+                render_system->set_parallel(true);
+                add_system(std::move(render_system));
+                LM.write_log("ECS_Manager::start_up(): Added system 'Render_System'.");
 
-            add_system(std::make_unique<GUI_System>(*this));
-            LM.write_log("ECS_Manager::start_up(): Added system 'GUI_System'.");
+                add_system(std::make_unique<GUI_System>(*this));
+                LM.write_log("ECS_Manager::start_up(): Added system 'GUI_System'.");
+            }
 
-            add_system(std::make_unique<Audio_System>());
-            LM.write_log("ECS_Manager::start_up(): Added system 'Audio_System'.");
+            if (audio_enabled) {
+                add_system(std::make_unique<Audio_System>());
+                LM.write_log("ECS_Manager::start_up(): Added system 'Audio_System'.");
+            }
 
-            add_system(std::make_unique<Animation_System>()); 
-            LM.write_log("ECS_Manager::start_up(): Added system 'Animation_System'.");
+            if (render_enabled) {
+                add_system(std::make_unique<Animation_System>());
+                LM.write_log("ECS_Manager::start_up(): Added system 'Animation_System'.");
+            }
 
             add_system(std::make_unique<Logic_System>());
             LM.write_log("ECS_Manager::start_up(): Added system 'Logic_System'.");
@@ -137,13 +191,21 @@ namespace lof {
             return;
         }
 
+        command_buffer.clear();
+        for (auto& system_list : component_systems) {
+            system_list.clear();
+        }
         systems.clear();
+        system_levels.clear();
         entities.clear();
+        entity_generations.clear();
+        free_indices.clear();
         entity_names.clear(); // Clear the name map
-        component_arrays.clear();
-        component_type_to_id.clear();
-        id_to_component_type.clear();
-        next_component_id = 0;
+        named_entities.clear();
+        prefab_copy_counts.clear();
+        for (auto& pool : component_pools) {
+            pool.reset();
+        }
 
         m_is_started = false;
         LM.write_log("ECS_Manager::shut_down(): ECS_Manager shut down successfully.");
@@ -159,18 +221,12 @@ namespace lof {
         LM.write_log("ECS_Manager::clone_entity_from_prefab(): Cloning entity from prefab '%s'.", prefab_name.c_str());
 
         // Validate prefab exists
-        const rapidjson::Value* prefab = SM.get_prefab(prefab_name);
+        const Prefab_Template* prefab = SM.get_prefab_template(prefab_name);
         if (!prefab) {
             LM.write_log("ECS_Manager::clone_entity_from_prefab(): Prefab '%s' not found.", prefab_name.c_str());
             return INVALID_ENTITY_ID;
         }
 
-        // Validate prefab has components
-        if (!prefab->HasMember("components") || !(*prefab)["components"].IsObject()) {
-            LM.write_log("ECS_Manager::clone_entity_from_prefab(): Prefab '%s' does not have valid components object.", prefab_name.c_str());
-            return INVALID_ENTITY_ID;
-        }
-
         // Determine the entity name
         std::string final_name;
         if (!entity_name.empty()) {
@@ -183,11 +239,7 @@ namespace lof {
         }
 
         // Ensure name uniqueness
-        std::string unique_name = final_name;
-        int suffix = 1;
-        while (entity_names.find(unique_name) != entity_names.end()) {
-            unique_name = final_name + "_" + std::to_string(suffix++);
-        }
+        std::string unique_name = make_unique_name(final_name);
 
         // Create new entity with the unique name
         EntityID eid = create_entity(unique_name);
@@ -197,9 +249,9 @@ namespace lof {
         }
 
         try {
-            // Add components from prefab
-            const rapidjson::Value& components = (*prefab)["components"];
-            add_components_from_json(eid, components);
+            // Copy the prefab's parsed components and update the systems once
+            prefab->instantiate(*this, eid);
+            update_entity_in_systems(eid);
 
             LM.write_log("ECS_Manager::clone_entity_from_prefab(): Successfully cloned entity '%s' with ID %u from prefab '%s'",
                 unique_name.c_str(), eid, prefab_name.c_str());
@@ -215,50 +267,201 @@ namespace lof {
 
 
     EntityID ECS_Manager::create_entity(const std::string& name) {
-        EntityID id = static_cast<EntityID>(entities.size());
-        entities.emplace_back(std::make_unique<Entity>(id, name));
+        EntityID id = allocate_entity(name);
+        if (id == INVALID_ENTITY_ID) {
+            LM.write_log("ECS_Manager::create_entity(): Maximum number of entities (%u) reached.", MAX_ENTITIES);
+            return INVALID_ENTITY_ID;
+        }
+
+        const std::string& final_name = entities[entity_index(id)]->get_name();
+        if (!final_name.empty()) {
+            LM.write_log("ECS_Manager::create_entity(): Created entity '%s' with ID %u.", final_name.c_str(), id);
+        }
+        else {
+            LM.write_log("ECS_Manager::create_entity(): Created unnamed entity with ID %u.", id);
+        }
+
+        // Update systems with the new entity
+        update_entity_in_systems(id);
+        return id;
+    }
+
+    std::vector<EntityID> ECS_Manager::create_entities(std::size_t count, const std::string& base_name) {
+        std::vector<EntityID> created;
+        created.reserve(count);
+
+        // Reserve the slots that cannot come from the free list
+        if (count > free_indices.size()) {
+            std::size_t new_slots = count - free_indices.size();
+            entities.reserve(entities.size() + new_slots);
+            entity_generations.reserve(entity_generations.size() + new_slots);
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            EntityID id = allocate_entity(base_name.empty() ? base_name : base_name + "_" + std::to_string(i));
+            if (id == INVALID_ENTITY_ID) {
+                LM.write_log("ECS_Manager::create_entities(): Maximum number of entities (%u) reached after %zu entities.", MAX_ENTITIES, i);
+                break;
+            }
+            created.push_back(id);
+        }
+
+        // Entities without components only match systems with an empty signature
+        for (EntityID id : created) {
+            update_entity_in_systems(id);
+        }
+
+        LM.write_log("ECS_Manager::create_entities(): Created %zu entities.", created.size());
+        return created;
+    }
+
+    std::vector<EntityID> ECS_Manager::instantiate_prefab_n(const std::string& prefab_name, std::size_t count) {
+        LM.write_log("ECS_Manager::instantiate_prefab_n(): Instantiating %zu entities from prefab '%s'.", count, prefab_name.c_str());
+
+        std::vector<EntityID> created;
+        if (count == 0) {
+            return created;
+        }
+
+        // Parse the prefab once into the first entity
+        EntityID source = clone_entity_from_prefab(prefab_name);
+        if (source == INVALID_ENTITY_ID) {
+            return created;
+        }
+        created.reserve(count);
+        created.push_back(source);
+
+        const ComponentMask source_mask = entities[entity_index(source)]->get_component_mask();
+
+        // Reserve pool capacity for every copy up front
+        for (std::size_t id = 0; id < component_pools.size(); ++id) {
+            if (component_pools[id] && source_mask.test(id)) {
+                component_pools[id]->reserve(component_pools[id]->size() + count - 1);
+            }
+        }
+        if (count - 1 > free_indices.size()) {
+            std::size_t new_slots = count - 1 - free_indices.size();
+            entities.reserve(entities.size() + new_slots);
+            entity_generations.reserve(entity_generations.size() + new_slots);
+        }
+
+        // Copy the source components into each new entity, numbering them after the previous copies
+        std::size_t& copy_count = prefab_copy_counts[prefab_name];
+        for (std::size_t i = 1; i < count; ++i) {
+            std::string unique_name;
+            do {
+                unique_name = prefab_name + "_" + std::to_string(++copy_count);
+            } while (name_in_use(unique_name));
+
+            EntityID eid = allocate_entity(unique_name);
+            if (eid == INVALID_ENTITY_ID) {
+                LM.write_log("ECS_Manager::instantiate_prefab_n(): Maximum number of entities (%u) reached after %zu entities.", MAX_ENTITIES, i);
+                break;
+            }
+
+            Entity& entity = *entities[entity_index(eid)];
+            for (std::size_t id = 0; id < component_pools.size(); ++id) {
+                if (component_pools[id] && source_mask.test(id)) {
+                    component_pools[id]->copy(source, eid);
+                    entity.add_component(id);
+                }
+            }
+            created.push_back(eid);
+        }
+
+        // Set system membership once per new entity
+        for (std::size_t i = 1; i < created.size(); ++i) {
+            update_entity_in_systems(created[i]);
+        }
+
+        LM.write_log("ECS_Manager::instantiate_prefab_n(): Instantiated %zu entities from prefab '%s'.", created.size(), prefab_name.c_str());
+        return created;
+    }
+
+    EntityID ECS_Manager::allocate_entity(const std::string& name) {
+        // Reuse a free slot if there is one, otherwise append a new slot
+        std::uint32_t index;
+        if (!free_indices.empty()) {
+            index = free_indices.back();
+            free_indices.pop_back();
+        }
+        else {
+            if (entities.size() >= MAX_ENTITIES) {
+                return INVALID_ENTITY_ID;
+            }
+            index = static_cast<std::uint32_t>(entities.size());
+            entities.emplace_back();
+            entity_generations.push_back(0);
+        }
+
+        EntityID id = make_entity_id(index, entity_generations[index]);
+        entities[index] = std::make_unique<Entity>(id, name);
 
         // If name is provided, store it in the lookup map
         if (!name.empty()) {
             // Check if name already exists
-            if (entity_names.find(name) != entity_names.end()) {
+            if (name_in_use(name)) {
                 LM.write_log("ECS_Manager::create_entity(): Warning: Entity name '%s' already exists. Using name with ID suffix.", name.c_str());
                 // If name already exists, append ID to make it unique
-                std::string unique_name = name + "_" + std::to_string(id);
-                entity_names[unique_name] = id;
+                std::string unique_name = make_unique_name(name + "_" + std::to_string(id));
+                bind_name(unique_name, id);
                 // Update the entity's name to match
-                entities.back()->set_name(unique_name);
+                entities[index]->set_name(unique_name);
             }
             else {
-                entity_names[name] = id;
+                bind_name(name, id);
             }
-            LM.write_log("ECS_Manager::create_entity(): Created entity '%s' with ID %u.", entities.back()->get_name().c_str(), id);
         }
-        else {
-            LM.write_log("ECS_Manager::create_entity(): Created unnamed entity with ID %u.", id);
+
+        return id;
+    }
+
+    bool ECS_Manager::name_in_use(std::string_view name) const {
+        NameID name_id = entity_names.find(name);
+        return name_id != INVALID_NAME_ID && named_entities[name_id] != INVALID_ENTITY_ID;
+    }
+
+    std::string ECS_Manager::make_unique_name(const std::string& base) const {
+        if (!name_in_use(base)) {
+            return base;
         }
 
-        // Resize component arrays if necessary
-        for (auto& component_pair : component_arrays) {
-            if (component_pair.second.size() <= id) {
-                component_pair.second.resize(entities.size());
+        // Reuse one buffer, rewriting only the digits after "base_" for each candidate
+        std::string candidate = base + "_";
+        const std::size_t prefix_length = candidate.size();
+        char digits[16];
+        for (unsigned int suffix = 1;; ++suffix) {
+            auto result = std::to_chars(digits, digits + sizeof(digits), suffix);
+            candidate.resize(prefix_length);
+            candidate.append(digits, result.ptr);
+            if (!name_in_use(candidate)) {
+                return candidate;
             }
         }
+    }
 
-        // Update systems with the new entity
-        update_entity_in_systems(id);
-        return id;
+    void ECS_Manager::bind_name(const std::string& name, EntityID entity) {
+        named_entities[intern_name(name)] = entity;
+    }
+
+    void ECS_Manager::unbind_name(const std::string& name) {
+        NameID name_id = entity_names.find(name);
+        if (name_id != INVALID_NAME_ID) {
+            named_entities[name_id] = INVALID_ENTITY_ID;
+        }
     }
 
 
     void ECS_Manager::destroy_entity(EntityID entity) {
-        if (entity >= entities.size() || !entities[entity]) {
+        if (!is_alive(entity)) {
             LM.write_log("ECS_Manager::destroy_entity(): Invalid entity ID or already destroyed: %u", entity);
             return;
         }
 
+        std::uint32_t index = entity_index(entity);
+
         // Log the entity being destroyed
-        const std::string& name = entities[entity]->get_name();
+        const std::string& name = entities[index]->get_name();
         LM.write_log("ECS_Manager::destroy_entity(): Starting destruction of entity %u (name: %s)", entity, name.c_str());
 
         // First remove from all systems
@@ -271,63 +474,45 @@ namespace lof {
 
         // Remove from name lookup if it has a name
         if (!name.empty()) {
-            entity_names.erase(name);
+            unbind_name(name);
             LM.write_log("Removed name mapping for '%s'", name.c_str());
         }
 
-        // Remove all components
-        for (auto& component_pair : component_arrays) {
-            auto& componentArray = component_pair.second;
-            if (entity < componentArray.size()) {
-                if (componentArray[entity]) {  // Check if component exists
-                    componentArray[entity].reset();
-                    LM.write_log("Reset component for entity %u", entity);
-                }
+        // Unlink from the hierarchy, children of a destroyed parent become roots
+        auto& hierarchy_pool = get_component_pool<Hierarchy_Component>();
+        if (hierarchy_pool.has(entity)) {
+            unlink_from_parent(entity);
+
+            EntityID child = hierarchy_pool.read(entity).first_child;
+            while (child != INVALID_ENTITY_ID) {
+                Hierarchy_Component& child_node = hierarchy_pool.get(child);
+                child = child_node.next_sibling;
+                child_node.parent = INVALID_ENTITY_ID;
+                child_node.next_sibling = INVALID_ENTITY_ID;
             }
         }
 
-        // Remove the entity from the entities vector
-        entities.erase(entities.begin() + entity);
-        LM.write_log("Removed entity from entities vector");
-
-        // Update the IDs of all entities that come after the removed one
-        for (size_t i = entity; i < entities.size(); i++) {
-            if (entities[i]) {
-                EntityID new_id = static_cast<EntityID>(i);
-                EntityID old_id = entities[i]->get_id();
-
-                // Update the entity's ID
-                entities[i]->set_id(new_id);
-
-                // Update name mapping
-                const std::string& entity_name = entities[i]->get_name();
-                if (!entity_name.empty()) {
-                    entity_names[entity_name] = new_id;
-                }
-
-                // Update system mappings
-                for (auto& system : systems) {
-                    if (system->has_entity(old_id)) {
-                        system->remove_entity(old_id);
-                        system->add_entity(new_id);
-                    }
-                }
-
-                LM.write_log("Updated entity %u to new ID %u", old_id, new_id);
+        // Remove all components
+        for (auto& pool : component_pools) {
+            if (pool) {
+                pool->remove(entity);
             }
         }
 
-        // Compact component arrays
-        for (auto& component_pair : component_arrays) {
-            auto& componentArray = component_pair.second;
-            if (entity < componentArray.size()) {
-                componentArray.erase(componentArray.begin() + entity);
-            }
-        }
+        // Release the slot and bump its generation so old handles become stale
+        entities[index].reset();
+        entity_generations[index] = (entity_generations[index] + 1) % PENDING_ENTITY_GENERATION;
+        free_indices.push_back(index);
 
         LM.write_log("ECS_Manager::destroy_entity(): Completed destruction of entity %u", entity);
     }
 
+    bool ECS_Manager::is_alive(EntityID entity) const {
+        std::uint32_t index = entity_index(entity);
+        return entity != INVALID_ENTITY_ID && index < entities.size() && entities[index] &&
+            entities[index]->get_id() == entity;
+    }
+
     const std::vector<std::unique_ptr<System>>& ECS_Manager::get_systems() const{
         return systems;
     }
@@ -338,38 +523,205 @@ namespace lof {
         LM.write_log("ECS_Manager::add_system(): Adding system '%s'.", system_type.c_str());
 
         systems.emplace_back(std::move(system));
+
+        // Index the system under each component it or its groups require or exclude
+        Signature signature = systems.back()->get_membership_signature();
+        for (std::size_t id = 0; id < component_systems.size(); ++id) {
+            if (signature.test(id)) {
+                component_systems[id].push_back(systems.back().get());
+            }
+        }
+        // Rebuild the update schedule with the new system
+        build_system_levels();
+
         LM.write_log("ECS_Manager::add_system(): System '%s' added successfully.", systems.back()->get_type().c_str());
     }
 
     void ECS_Manager::update(float delta_time) {
-        for (auto& system : systems) {
+        // Sync point: apply changes recorded since the last frame
+        flush_commands();
+
+        // Decide which systems are due this frame, systems paused by the editor do not accumulate time
+        std::vector<char> due(systems.size(), 0);
+        for (std::size_t index = 0; index < systems.size(); ++index) {
+            System& system = *systems[index];
+            if (!level_editor_mode || system.runs_in_editor()) {
+                due[index] = system.advance_frame(delta_time);
+            }
+        }
 
-            if (system->get_type() == "Movement_System" || system->get_type() == "Collision_System" || system->get_type() == "Audio_System") {
+        // Systems in the same level share no written components, so they can update concurrently
+        for (const auto& level : system_levels) {
+            Job_Counter counter;
+
+            // Changes made by earlier levels are newer than the tick the systems of this level start with
+            ++change_tick;
+
+            // Hand worker-safe systems to the job manager first so they start while the main thread works
+            for (std::size_t index : level) {
+                System* system = systems[index].get();
+                if (due[index] && !system->is_main_thread_only()) {
+                    JM.submit([this, system]() {
+                        // Workers may serve several worlds, so bind this one for the job
+                        ECS_Binding binding(*this);
+                        update_system(*system, system->get_update_delta());
+                    }, counter);
+                }
+            }
 
-                if (!level_editor_mode) {
-                    // Getting delta time for each system
-                    system->set_time(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
-                    // Updating each system
-                    system->update(delta_time);
-                    system->set_time(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - system->get_time());
+            for (std::size_t index : level) {
+                System* system = systems[index].get();
+                if (due[index] && system->is_main_thread_only()) {
+                    update_system(*system, system->get_update_delta());
                 }
+            }
+
+            JM.wait(counter);
+        }
+
+        // Sync point: apply changes recorded by the systems this frame
+        flush_commands();
+
+        // Keep spatial neighbours close in memory for the next frames
+        if (spatial_sort_interval > 0 && ++frames_since_spatial_sort >= spatial_sort_interval) {
+            frames_since_spatial_sort = 0;
+            sort_spatially();
+        }
 
+        // Record the frame for rewinding, history is frozen while the editor is rewinding it
+        if (history_enabled && !level_editor_mode) {
+            snapshots.update(*this);
+        }
+
+        // Changes made between frames, such as by the editor, are newer than every system's tick
+        ++change_tick;
+    }
+
+    void ECS_Manager::update_system(System& system, float delta_time) {
+        // Getting delta time for each system
+        system.set_time(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        // Updating each system
+        system.update(delta_time);
+        system.set_time(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - system.get_time());
+    }
+
+    void ECS_Manager::build_system_levels() {
+        // A system runs one level after the latest earlier system it conflicts with,
+        // which keeps the registration order between every pair of conflicting systems
+        std::vector<std::size_t> level_of(systems.size(), 0);
+        system_levels.clear();
+
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            for (std::size_t j = 0; j < i; ++j) {
+                if (systems[i]->conflicts_with(*systems[j])) {
+                    level_of[i] = std::max(level_of[i], level_of[j] + 1);
+                }
             }
-            else {
-                // Getting delta time for each system
-                system->set_time(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
-                // Updating each system
-                system->update(delta_time);
-                system->set_time(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - system->get_time());
+
+            if (level_of[i] >= system_levels.size()) {
+                system_levels.resize(level_of[i] + 1);
+            }
+            system_levels[level_of[i]].push_back(i);
+        }
+
+        // Stagger systems with a reduced update rate so they do not all update on the same frame
+        std::size_t rated_count = 0;
+        for (const auto& system : systems) {
+            rated_count += system->get_update_interval() > 0.0f;
+        }
+        std::size_t rated_index = 0;
+        for (const auto& system : systems) {
+            float interval = system->get_update_interval();
+            if (interval > 0.0f) {
+                system->set_update_phase(interval * static_cast<float>(rated_index++) / static_cast<float>(rated_count));
             }
-            
-            
         }
     }
 
+    bool ECS_Manager::sort_spatially() {
+        auto& transform_pool = get_component_pool<Transform2D>();
+        const std::vector<EntityID>& owners = transform_pool.get_entities();
+        const std::vector<Transform2D>& transforms = transform_pool.get_components();
+
+        std::vector<std::uint32_t> codes(transforms.size());
+        for (std::size_t i = 0; i < transforms.size(); ++i) {
+            codes[i] = morton_code(transforms[i].position.x, transforms[i].position.y, DEFAULT_SPATIAL_SORT_CELL_SIZE);
+        }
+        if (std::is_sorted(codes.begin(), codes.end())) {
+            return false;
+        }
+
+        // The pools are still sorted from the last pass apart from entities that changed cells, so an
+        // insertion pass is close to linear. It falls back to a full sort when too many entities moved.
+        // Both are stable, so entities sharing a cell keep their current order
+        std::vector<std::size_t> by_code(codes.size());
+        std::iota(by_code.begin(), by_code.end(), std::size_t{ 0 });
+        std::size_t shifts_left = codes.size() * MAX_SPATIAL_SORT_SHIFTS_PER_ENTITY;
+        bool incremental = true;
+        for (std::size_t i = 1; incremental && i < by_code.size(); ++i) {
+            std::size_t moving = by_code[i];
+            std::size_t j = i;
+            for (; j > 0 && codes[by_code[j - 1]] > codes[moving]; --j) {
+                if (shifts_left-- == 0) {
+                    incremental = false;
+                    break;
+                }
+                by_code[j] = by_code[j - 1];
+            }
+            by_code[j] = moving;
+        }
+        if (!incremental) {
+            std::iota(by_code.begin(), by_code.end(), std::size_t{ 0 });
+            std::stable_sort(by_code.begin(), by_code.end(), [&codes](std::size_t a, std::size_t b) {
+                return codes[a] < codes[b];
+            });
+        }
+        std::vector<EntityID> order;
+        order.reserve(by_code.size());
+        for (std::size_t index : by_code) {
+            order.push_back(owners[index]);
+        }
+
+        transform_pool.reorder(order);
+        get_component_pool<Collision_Component>().reorder(order);
+        get_component_pool<Physics_Component>().reorder(order);
+        get_component_pool<Velocity_Component>().reorder(order);
+        for (auto& system : systems) {
+            if (system->is_spatially_ordered()) {
+                system->reorder_entities(order);
+            }
+        }
+        return true;
+    }
+
+    void ECS_Manager::set_spatial_sort_interval(unsigned int frames) {
+        spatial_sort_interval = frames;
+        frames_since_spatial_sort = 0;
+    }
+
+    bool ECS_Manager::is_render_enabled() const {
+        return render_enabled;
+    }
+
+    std::uint32_t ECS_Manager::get_change_tick() const {
+        return change_tick;
+    }
+
+    Entity_Command_Buffer& ECS_Manager::get_command_buffer() {
+        return command_buffer;
+    }
+
+    void ECS_Manager::flush_commands() {
+        command_buffer.flush(*this);
+    }
+
+    Snapshot_Buffer& ECS_Manager::get_snapshot_buffer() {
+        return snapshots;
+    }
+
     Entity* ECS_Manager::get_entity(EntityID entity_id) {
-        if (entity_id < entities.size()) {
-            return entities[entity_id].get();
+        if (is_alive(entity_id)) {
+            return entities[entity_index(entity_id)].get();
         }
         return nullptr;
     }
@@ -379,17 +731,99 @@ namespace lof {
     }
 
     EntityID ECS_Manager::find_entity_by_name(const std::string& name) const {
-        auto it = entity_names.find(name);
-        if (it != entity_names.end()) {
-            return it->second;
+        return find_entity_by_name(entity_names.find(name));
+    }
+
+    EntityID ECS_Manager::find_entity_by_name(NameID name_id) const {
+        if (name_id < named_entities.size()) {
+            return named_entities[name_id];
         }
         return INVALID_ENTITY_ID;
     }
 
+    NameID ECS_Manager::intern_name(const std::string& name) {
+        NameID name_id = entity_names.intern(name);
+        if (name_id >= named_entities.size()) {
+            named_entities.resize(static_cast<std::size_t>(name_id) + 1, INVALID_ENTITY_ID);
+        }
+        return name_id;
+    }
+
+    bool ECS_Manager::set_parent(EntityID child, EntityID parent) {
+        if (!is_alive(child) || !is_alive(parent) || child == parent) {
+            LM.write_log("ECS_Manager::set_parent(): Invalid child %u or parent %u.", child, parent);
+            return false;
+        }
+
+        // Refuse links that would make the child an ancestor of itself
+        auto& hierarchy_pool = get_component_pool<Hierarchy_Component>();
+        for (EntityID ancestor = parent; ancestor != INVALID_ENTITY_ID && hierarchy_pool.has(ancestor);
+            ancestor = hierarchy_pool.read(ancestor).parent) {
+            if (ancestor == child) {
+                LM.write_log("ECS_Manager::set_parent(): Entity %u is an ancestor of %u, link would form a cycle.", child, parent);
+                return false;
+            }
+        }
+
+        // Add the components before taking references, since adding may move the pool's storage
+        if (!hierarchy_pool.has(child)) {
+            add_component(child, Hierarchy_Component());
+        }
+        if (!hierarchy_pool.has(parent)) {
+            add_component(parent, Hierarchy_Component());
+        }
+
+        unlink_from_parent(child);
+
+        Hierarchy_Component& parent_node = hierarchy_pool.get(parent);
+        Hierarchy_Component& child_node = hierarchy_pool.get(child);
+        child_node.parent = parent;
+        child_node.next_sibling = parent_node.first_child;
+        parent_node.first_child = child;
+        return true;
+    }
+
+    void ECS_Manager::remove_parent(EntityID child) {
+        if (!is_alive(child) || !get_component_pool<Hierarchy_Component>().has(child)) {
+            return;
+        }
+        unlink_from_parent(child);
+    }
+
+    void ECS_Manager::unlink_from_parent(EntityID entity) {
+        auto& hierarchy_pool = get_component_pool<Hierarchy_Component>();
+        Hierarchy_Component& node = hierarchy_pool.get(entity);
+        if (node.parent == INVALID_ENTITY_ID) {
+            return;
+        }
+
+        // Splice the entity out of its parent's singly linked child list
+        if (hierarchy_pool.has(node.parent)) {
+            Hierarchy_Component& parent_node = hierarchy_pool.get(node.parent);
+            if (parent_node.first_child == entity) {
+                parent_node.first_child = node.next_sibling;
+            }
+            else {
+                EntityID sibling = parent_node.first_child;
+                while (sibling != INVALID_ENTITY_ID) {
+                    const Hierarchy_Component& sibling_node = hierarchy_pool.read(sibling);
+                    if (sibling_node.next_sibling == entity) {
+                        hierarchy_pool.get(sibling).next_sibling = node.next_sibling;
+                        break;
+                    }
+                    sibling = sibling_node.next_sibling;
+                }
+            }
+        }
+
+        node.parent = INVALID_ENTITY_ID;
+        node.next_sibling = INVALID_ENTITY_ID;
+    }
+
     bool ECS_Manager::update_entity_name(EntityID entity_id, const std::string& new_name) {
         if (auto* entity = get_entity(entity_id)) {
             // First check if new name already exists (unless it's empty)
-            if (!new_name.empty() && entity_names.find(new_name) != entity_names.end()) {
+            if (!new_name.empty() && name_in_use(new_name)) {
                 LM.write_log("ECS_Manager::update_entity_name(): Name '%s' already exists.", new_name.c_str());
                 return false;
             }
@@ -397,13 +831,13 @@ namespace lof {
             // Remove old name from map if it exists
             const std::string& old_name = entity->get_name();
             if (!old_name.empty()) {
-                entity_names.erase(old_name);
+                unbind_name(old_name);
                 LM.write_log("ECS_Manager::update_entity_name(): Removed old name mapping for '%s'", old_name.c_str());
             }
 
             // Add new name if provided
             if (!new_name.empty()) {
-                entity_names[new_name] = entity_id;
+                bind_name(new_name, entity_id);
                 LM.write_log("ECS_Manager::update_entity_name(): Added new name mapping for '%s'", new_name.c_str());
             }
 
@@ -418,23 +852,50 @@ namespace lof {
     }
 
     void ECS_Manager::update_entity_in_systems(EntityID entity) {
-        const ComponentMask& entity_mask = entities[entity]->get_component_mask();
+        const ComponentMask& entity_mask = entities[entity_index(entity)]->get_component_mask();
 
         for (auto& system : systems) {
-            const Signature& system_signature = system->get_signature();
+            update_entity_in_system(*system, entity, entity_mask);
+        }
+    }
 
-            // Check if entity_mask includes all bits set in system_signature
-            bool matches = (entity_mask & system_signature) == system_signature;
+    void ECS_Manager::update_entity_in_systems(EntityID entity, std::size_t component_id) {
+        const ComponentMask& entity_mask = entities[entity_index(entity)]->get_component_mask();
 
+        // Only systems requiring or excluding the changed component can change membership
+        for (System* system : component_systems[component_id]) {
+            update_entity_in_system(*system, entity, entity_mask);
+        }
+    }
+
+    void ECS_Manager::update_entity_in_systems(EntityID entity, const ComponentMask& changed) {
+        const ComponentMask& entity_mask = entities[entity_index(entity)]->get_component_mask();
+
+        for (std::size_t id = 0; id < component_systems.size(); ++id) {
+            if (changed.test(id)) {
+                for (System* system : component_systems[id]) {
+                    update_entity_in_system(*system, entity, entity_mask);
+                }
+            }
+        }
+    }
+
+    void ECS_Manager::update_entity_in_system(System& system, EntityID entity, const ComponentMask& entity_mask) {
+        // Check if entity_mask includes all required components and none of the excluded ones
+        bool matches = system.matches(entity_mask);
+
+        // Skip membership operations that change nothing
+        if (matches != system.has_entity(entity)) {
             if (matches) {
-                system->add_entity(entity);
-                LM.write_log("Entity %u added to system %s.", entity, system->get_type().c_str());
+                system.add_entity(entity);
             }
             else {
-                system->remove_entity(entity);
-                LM.write_log("Entity %u removed from system %s.", entity, system->get_type().c_str());
+                system.remove_entity(entity);
             }
         }
+
+        // The entity can change groups while staying in the system
+        system.update_groups(entity, entity_mask);
     }
 
 } // namespace lof
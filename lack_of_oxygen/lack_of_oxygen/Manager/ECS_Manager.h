@@ -20,48 +20,161 @@
 // Include other necessary headers
 #include "../Entity/Entity.h"
 #include "../Component/Component.h"
+#include "../Component/Component_Pool.h"
+#include "ECS_View.h"
+#include "Entity_Command_Buffer.h"
+#include "Prefab_Template.h"
+#include "Snapshot_Buffer.h"
 #include "../System/System.h"
 #include "../Manager/Serialization_Manager.h"
+#include "../Utility/String_Interner.h"
 
 // Include standard headers
 #include <vector>
 #include <memory>
 #include <unordered_map>
-#include <typeindex>
-#include <typeinfo>
-#include <unordered_set>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 #include <cassert> // For assert
 
 namespace lof {
 
+    class World;
+
     /**
      * @class ECS_Manager
      * @brief Manages entities, components, and systems in the ECS architecture.
+     * @details The game uses one process-wide instance. Each World owns another instance, and
+     *          ECSM resolves to the instance bound to the calling thread with ECS_Binding, falling
+     *          back to the process-wide one, so systems written against ECSM run in any world.
      */
     class ECS_Manager : public Manager {
     private:
-        // Private constructor for singleton pattern
+        // Private constructor for singleton pattern, worlds create their own instances
         ECS_Manager();
+        friend class World;
+
+        // Systems that draw, play sound or read the mouse are only added when enabled
+        bool render_enabled = true;
+        bool audio_enabled = true;
 
-        // Entity storage
+        // Frames are only recorded for rewinding when enabled
+        bool history_enabled = true;
+
+        // Entity storage, indexed by entity slot index (destroyed slots are nullptr)
         std::vector<std::unique_ptr<Entity>> entities;
 
+        // Current generation of each entity slot and the slots free for reuse
+        std::vector<std::uint32_t> entity_generations;
+        std::vector<std::uint32_t> free_indices;
+
         // System storage
         std::vector<std::unique_ptr<System>> systems;
 
-        // Component storage
-        std::unordered_map<std::type_index, std::vector<std::unique_ptr<Component>>> component_arrays;
-        // Component identification
-        std::unordered_map<std::type_index, std::size_t> component_type_to_id;
-        std::unordered_map<std::size_t, const std::type_info*> id_to_component_type;
-        std::size_t next_component_id = 0;
+        // Systems requiring or excluding each component, indexed by component ID
+        std::array<std::vector<System*>, MAX_COMPONENTS> component_systems;
+
+        // Update schedule, each level holds indices of systems that can update concurrently
+        std::vector<std::vector<std::size_t>> system_levels;
+
+        /**
+         * @brief Group the systems into levels from their declared component access, and spread
+         *        the first updates of systems with a reduced update rate across frames.
+         */
+        void build_system_levels();
+
+        /**
+         * @brief Update a system and record its consumption time.
+         * @param system The system to update.
+         * @param delta_time The time elapsed since the last update.
+         */
+        static void update_system(System& system, float delta_time);
+
+        // Component storage, indexed by component ID (unregistered types are nullptr)
+        std::array<std::unique_ptr<Component_Pool_Base>, MAX_COMPONENTS> component_pools;
+
+        // Entity name lookup, names are interned once and index the entity holding them
+        String_Interner entity_names;
+        std::vector<EntityID> named_entities;
 
-        // Entity name lookup
-        std::unordered_map<std::string, EntityID> entity_names;
+        // Last name suffix given to the copies of each prefab by instantiate_prefab_n()
+        std::unordered_map<std::string, std::size_t> prefab_copy_counts;
 
-        // Helper member functions
+        // Tick stamped on component changes, advanced before each system level and after update()
+        std::uint32_t change_tick = 1;
+
+        // Structural changes deferred to the next sync point
+        Entity_Command_Buffer command_buffer;
+
+        // History of component state for rewinding in the level editor
+        Snapshot_Buffer snapshots{ DEFAULT_SNAPSHOT_CAPACITY, DEFAULT_SNAPSHOT_INTERVAL };
+
+        // Frames between spatial sorts of the pools, and frames since the last sort
+        unsigned int spatial_sort_interval = DEFAULT_SPATIAL_SORT_INTERVAL;
+        unsigned int frames_since_spatial_sort = 0;
+
+        // The command buffer applies component changes and updates systems once per entity
+        friend class Entity_Command_Buffer;
+
+        // Prefab templates copy their components in and the caller updates systems once per entity
+        friend class Prefab_Template;
+
+        /**
+         * @brief Store a component on an entity without updating the systems.
+         * @param entity The ID of the entity.
+         * @param component The component value to store.
+         */
+        template<typename T>
+        void insert_component(EntityID entity, T component);
+
+        /**
+         * @brief Remove a component from an entity without updating the systems.
+         * @param entity The ID of the entity.
+         */
         template<typename T>
-        std::vector<std::unique_ptr<Component>>& get_component_array();
+        void erase_component(EntityID entity);
+
+        /**
+         * @brief Take a free entity slot and register the entity's name, without logging or updating systems.
+         * @param name Optional name for the entity.
+         * @return The ID of the new entity, or INVALID_ENTITY_ID if no slot is available.
+         */
+        EntityID allocate_entity(const std::string& name);
+
+        /**
+         * @brief Check if a name is held by a live entity.
+         * @param name The name to check.
+         * @return True if an entity holds the name, false otherwise.
+         */
+        bool name_in_use(std::string_view name) const;
+
+        /**
+         * @brief Build a name that no entity holds by appending "_1", "_2", ... to a base name.
+         * @param base The preferred name, returned unchanged if it is free.
+         * @return A name not held by any entity.
+         */
+        std::string make_unique_name(const std::string& base) const;
+
+        /**
+         * @brief Point a name at an entity in the name lookup.
+         * @param name The name, interned if it is new.
+         * @param entity The ID of the entity holding the name.
+         */
+        void bind_name(const std::string& name, EntityID entity);
+
+        /**
+         * @brief Remove a name from the name lookup. Its NameID stays valid for the next holder.
+         * @param name The name to release.
+         */
+        void unbind_name(const std::string& name);
+
+        /**
+         * @brief Remove an entity from its parent's child list without touching its own children.
+         * @param entity The ID of an entity with a Hierarchy_Component.
+         */
+        void unlink_from_parent(EntityID entity);
 
         /**
          * @brief Update systems' entity lists based on an entity's signature.
@@ -69,13 +182,42 @@ namespace lof {
          */
         void update_entity_in_systems(EntityID entity);
 
+        /**
+         * @brief Update the entity lists of the systems requiring a component that was added or removed.
+         * @param entity The ID of the entity to update.
+         * @param component_id The ID of the changed component.
+         */
+        void update_entity_in_systems(EntityID entity, std::size_t component_id);
+
+        /**
+         * @brief Update the entity lists of the systems requiring any of the changed components.
+         * @param entity The ID of the entity to update.
+         * @param changed Mask of the components that were added or removed.
+         */
+        void update_entity_in_systems(EntityID entity, const ComponentMask& changed);
+
+        /**
+         * @brief Add or remove an entity from one system, skipping the operation if membership is unchanged.
+         * @param system The system to update.
+         * @param entity The ID of the entity to update.
+         * @param entity_mask The entity's component mask.
+         */
+        void update_entity_in_system(System& system, EntityID entity, const ComponentMask& entity_mask);
+
     public:
         /**
-         * @brief Get the singleton instance of ECS_Manager.
-         * @return Reference to the singleton instance.
+         * @brief Get the ECS_Manager of the calling thread.
+         * @return Reference to the instance bound with ECS_Binding, or the process-wide instance.
          */
         static ECS_Manager& get_instance();
 
+        /**
+         * @brief Make an instance the one returned by get_instance() on the calling thread.
+         * @param ecs The instance to bind, or nullptr for the process-wide instance.
+         * @return The previously bound instance, nullptr if none was bound.
+         */
+        static ECS_Manager* bind(ECS_Manager* ecs);
+
         // Delete copy constructor and assignment operator
         ECS_Manager(const ECS_Manager&) = delete;
         ECS_Manager& operator=(const ECS_Manager&) = delete;
@@ -84,9 +226,27 @@ namespace lof {
         int start_up() override;
         void shut_down() override;
 
-        // Entity destruction
+        /**
+         * @brief Destroy an entity and release its slot for reuse.
+         * @details The slot's generation is bumped, so every handle still holding the old ID
+         *          is detected as stale by is_alive() and get_entity().
+         * @param entity The ID of the entity to destroy.
+         */
         void destroy_entity(EntityID entity);
 
+        /**
+         * @brief Check if the ECS_Manager draws, and so shares the Graphics_Manager's animation state.
+         * @return True if the render, GUI and animation systems were added, false otherwise.
+         */
+        bool is_render_enabled() const;
+
+        /**
+         * @brief Check if an entity ID refers to a live entity.
+         * @param entity The ID of the entity to check.
+         * @return True if the entity exists and the ID's generation is current, false otherwise.
+         */
+        bool is_alive(EntityID entity) const;
+
         /**
          * @brief Create an entity with an optional name.
          * @param name Optional name for the entity.
@@ -94,10 +254,30 @@ namespace lof {
          */
         EntityID create_entity(const std::string& name = "");
 
+        /**
+         * @brief Create several entities at once.
+         * @param count The number of entities to create.
+         * @param base_name Optional base name, suffixed with "_<n>" for each entity.
+         * @return The IDs of the created entities.
+         */
+        std::vector<EntityID> create_entities(std::size_t count, const std::string& base_name = "");
+
+        /**
+         * @brief Spawn several entities from a prefab in one call.
+         * @details The prefab is parsed once into the first entity, then its components are copied
+         *          into the rest with pool capacity reserved up front and system membership set once
+         *          per entity. The copies are named "<prefab_name>_<n>" from a running count per
+         *          prefab, so naming them does not probe every suffix already in use.
+         * @param prefab_name The name of the prefab to instantiate.
+         * @param count The number of entities to spawn.
+         * @return The IDs of the spawned entities, empty if the prefab could not be instantiated.
+         */
+        std::vector<EntityID> instantiate_prefab_n(const std::string& prefab_name, std::size_t count);
+
         /**
          * @brief Get a pointer to an entity by its ID.
          * @param entity_id The ID of the entity to retrieve.
-         * @return Pointer to the entity if found, nullptr otherwise.
+         * @return Pointer to the entity if found and alive, nullptr otherwise.
          */
         Entity* get_entity(EntityID entity_id);
 
@@ -108,6 +288,30 @@ namespace lof {
          */
         EntityID find_entity_by_name(const std::string& name) const;
 
+        /**
+         * @brief Find an entity by an interned name, without hashing the string.
+         * @param name_id The ID returned by intern_name().
+         * @return The entity ID if an entity holds the name, INVALID_ENTITY_ID otherwise.
+         */
+        EntityID find_entity_by_name(NameID name_id) const;
+
+        /**
+         * @brief Intern an entity name so hot paths can look it up by ID.
+         * @details The ID stays valid until shut down, whether or not an entity holds the name.
+         * @param name The name to intern.
+         * @return The ID of the name.
+         */
+        NameID intern_name(const std::string& name);
+
+        /**
+         * @brief Get the entity owning a tag or singleton component.
+         * @details Reads the first entry of the component's pool, so it is O(1) and callers can
+         *          fetch it once per update. If several entities own T, any one may be returned.
+         * @return The ID of an entity owning T, INVALID_ENTITY_ID if there is none.
+         */
+        template<typename T>
+        EntityID get_singleton();
+
         /**
          * @brief Update the name of an existing entity.
          * @param entity_id The ID of the entity to update.
@@ -116,6 +320,22 @@ namespace lof {
          */
         bool update_entity_name(EntityID entity_id, const std::string& new_name);
 
+        /**
+         * @brief Attach an entity to a parent, detaching it from any previous parent.
+         * @details Both entities get a Hierarchy_Component if they lack one. The child's Transform2D
+         *          becomes relative to the parent from the next Hierarchy_System update.
+         * @param child The ID of the entity to attach.
+         * @param parent The ID of the new parent.
+         * @return True if the link was made, false if either entity is invalid or the link would form a cycle.
+         */
+        bool set_parent(EntityID child, EntityID parent);
+
+        /**
+         * @brief Detach an entity from its parent, making it a root.
+         * @param child The ID of the entity to detach.
+         */
+        void remove_parent(EntityID child);
+
         /**
          * @brief Clone an entity based on a prefab.
          * @param prefab_name The name of the prefab to clone from.
@@ -147,141 +367,335 @@ namespace lof {
         template<typename T>
         bool has_component(EntityID entity) const;
 
+        /**
+         * @brief Stamp a component of an entity as changed, for writes made through a constant reference
+         *        or the packed component array.
+         * @param entity The ID of the entity, which must have the component.
+         */
+        template<typename T>
+        void mark_dirty(EntityID entity);
+
+        /**
+         * @brief Check if a component of an entity changed after a given tick.
+         * @param entity The ID of the entity, which must have the component.
+         * @param tick The tick to compare against, usually from get_change_tick() when the caller last ran.
+         * @return True if the component was added or written after the tick, false otherwise.
+         */
         template<typename T>
-        std::size_t get_component_id() const;
+        bool changed_since(EntityID entity, std::uint32_t tick) const;
+
+        /**
+         * @brief Get the current change tick.
+         * @details Changes made during a system's update are stamped with the tick current when the
+         *          system started, and systems scheduled later, or the next frame, see a greater tick.
+         *          A system that records this value when it starts can pass it to changed_since() on
+         *          its next update to visit only entities changed by others in between.
+         * @return The tick that changes are currently stamped with.
+         */
+        std::uint32_t get_change_tick() const;
+
+        /**
+         * @brief Get the ID of a component type.
+         * @return The component type's position in Component_List, known at compile time.
+         */
+        template<typename T>
+        static constexpr std::size_t get_component_id();
+
+        /**
+         * @brief Get the storage pool of a component type.
+         * @return Reference to the pool holding every component of type T.
+         */
+        template<typename T>
+        Component_Pool<T>& get_component_pool();
+
+        /**
+         * @brief Get a view over the entities owning all of the given component types.
+         * @details The pools are resolved once, so hot loops should fetch the view before iterating.
+         * @return An ECS_View over the pools of Ts.
+         */
+        template<typename... Ts>
+        ECS_View<Ts...> view();
 
         // System management
         void add_system(std::unique_ptr<System> system);
+
+        /**
+         * @brief Update every system.
+         * @details Systems are scheduled from their read and write signatures. Systems that do not
+         *          conflict run concurrently on the Job_Manager's workers, main-thread-only systems
+         *          run on the calling thread, and conflicting systems keep their registration order.
+         *          Systems must record structural changes in the command buffer. A system with an
+         *          update rate only updates when it is due, and receives the time elapsed since its
+         *          previous update instead of the frame time.
+         * @param delta_time The time elapsed since the last update.
+         */
         void update(float delta_time);
 
+        /**
+         * @brief Get the command buffer for deferring structural changes.
+         * @details Systems should record entity creation, destruction and component changes here
+         *          during update(). The buffer is played back at the start and end of update().
+         * @return Reference to the ECS_Manager's command buffer.
+         */
+        Entity_Command_Buffer& get_command_buffer();
+
+        /**
+         * @brief Play back every command recorded in the command buffer.
+         */
+        void flush_commands();
+
+        /**
+         * @brief Get the snapshot history of component state.
+         * @details A snapshot is captured at the end of update() every DEFAULT_SNAPSHOT_INTERVAL
+         *          frames while the level editor is inactive.
+         * @return Reference to the ECS_Manager's snapshot buffer.
+         */
+        Snapshot_Buffer& get_snapshot_buffer();
+
+        /**
+         * @brief Sort the Transform2D, Collision, Physics and Velocity pools by the Morton code of
+         *        each entity's position, and the entity lists of spatially ordered systems to match.
+         * @details Entities in the same grid cell keep their relative order, so entities that do not
+         *          move, static ones in particular, keep their place. Nothing is moved when the pools
+         *          are already in order, and an insertion pass moves the few entities that changed
+         *          cells, with a full sort only when many did. Invalidates references into the sorted pools, so it must only
+         *          run at a sync point.
+         * @return True if the pools were reordered, false if they were already sorted.
+         */
+        bool sort_spatially();
+
+        /**
+         * @brief Set how often update() sorts the pools by position.
+         * @param frames The number of frames between sorts, 0 to disable sorting.
+         */
+        void set_spatial_sort_interval(unsigned int frames);
+
         // Accessing each system
         const std::vector<std::unique_ptr<System>>& get_systems() const;
 
-        // Access entities
+        /**
+         * @brief Get the registered system of a given type.
+         * @return Pointer to the first system of type T, or nullptr if none was added.
+         */
+        template<typename T>
+        T* get_system() const;
+
+        // Access entities, indexed by slot index (destroyed slots are nullptr)
         const std::vector<std::unique_ptr<Entity>>& get_entities() const;
     };
 
+    /**
+     * @class ECS_Binding
+     * @brief Binds an ECS_Manager to the calling thread for the lifetime of the binding.
+     * @details The previous binding is restored on destruction, so bindings can nest.
+     */
+    class ECS_Binding {
+    private:
+        ECS_Manager* previous; ///< Instance bound before this binding
+
+    public:
+        /**
+         * @brief Bind an instance to the calling thread.
+         * @param ecs The instance ECSM resolves to until the binding is destroyed.
+         */
+        explicit ECS_Binding(ECS_Manager& ecs) : previous(ECS_Manager::bind(&ecs)) {}
+
+        /**
+         * @brief Restore the previous binding.
+         */
+        ~ECS_Binding() {
+            ECS_Manager::bind(previous);
+        }
+
+        // Delete copy constructor and assignment operator
+        ECS_Binding(const ECS_Binding&) = delete;
+        ECS_Binding& operator=(const ECS_Binding&) = delete;
+    };
+
     // Template Definitions
     // **All template definitions are within the `lof` namespace**
 
     template<typename T>
     void ECS_Manager::register_component() {
-        std::type_index typeIndex(typeid(T));
+        constexpr std::size_t id = get_component_id<T>();
 
         // Ensure component type hasn't been registered before
-        assert(component_type_to_id.find(typeIndex) == component_type_to_id.end() && "Component type already registered.");
+        assert(!component_pools[id] && "Component type already registered.");
 
-        component_type_to_id[typeIndex] = next_component_id;
-        id_to_component_type[next_component_id] = &typeid(T);
-        component_arrays[typeIndex] = std::vector<std::unique_ptr<Component>>(entities.size());
+        component_pools[id] = std::make_unique<Component_Pool<T>>();
+        component_pools[id]->set_change_tick(&change_tick);
+    }
 
-        next_component_id++;
+    template<typename T>
+    void ECS_Manager::add_component(EntityID entity, T component) {
+        insert_component<T>(entity, std::move(component));
 
-        // Ensure next_component_id doesn't exceed MAX_COMPONENTS
-        // Assuming MAX_COMPONENTS is defined elsewhere
-        assert(next_component_id <= MAX_COMPONENTS && "Exceeded maximum number of components.");
+        // Update systems
+        update_entity_in_systems(entity, get_component_id<T>());
     }
 
     template<typename T>
-    void ECS_Manager::add_component(EntityID entity, T component) {
-        std::type_index typeIndex(typeid(T));
+    void ECS_Manager::remove_component(EntityID entity) {
+        erase_component<T>(entity);
+
+        // Update systems
+        update_entity_in_systems(entity, get_component_id<T>());
+    }
+
+    template<typename T>
+    void ECS_Manager::insert_component(EntityID entity, T component) {
+        constexpr std::size_t id = get_component_id<T>();
 
         // Ensure component type is registered
-        assert(component_type_to_id.find(typeIndex) != component_type_to_id.end() && "Component type not registered.");
+        assert(component_pools[id] && "Component type not registered.");
 
         // Ensure entity ID is valid
-        assert(entity < entities.size() && "Entity ID out of range.");
+        assert(is_alive(entity) && "Entity ID is invalid or stale.");
 
         // Add component to entity
-        entities[entity]->add_component(component_type_to_id[typeIndex]);
+        entities[entity_index(entity)]->add_component(id);
 
         // Store component
-        auto& componentArray = get_component_array<T>();
-
-        // Resize the component array if necessary
-        if (componentArray.size() <= entity) {
-            componentArray.resize(entities.size());
-        }
-
-        componentArray[entity] = std::make_unique<T>(component);
-
-        // Update systems
-        update_entity_in_systems(entity);
+        get_component_pool<T>().insert(entity, std::move(component));
     }
 
     template<typename T>
-    void ECS_Manager::remove_component(EntityID entity) {
-        std::type_index typeIndex(typeid(T));
+    void ECS_Manager::erase_component(EntityID entity) {
+        constexpr std::size_t id = get_component_id<T>();
 
         // Ensure component type is registered
-        assert(component_type_to_id.find(typeIndex) != component_type_to_id.end() && "Component type not registered.");
+        assert(component_pools[id] && "Component type not registered.");
 
         // Ensure entity ID is valid
-        assert(entity < entities.size() && "Entity ID out of range.");
+        assert(is_alive(entity) && "Entity ID is invalid or stale.");
 
         // Remove component from entity
-        entities[entity]->remove_component(component_type_to_id[typeIndex]);
+        entities[entity_index(entity)]->remove_component(id);
 
         // Remove component from storage
-        auto& componentArray = get_component_array<T>();
-        componentArray[entity].reset();
+        get_component_pool<T>().remove(entity);
+    }
 
-        // Update systems
-        update_entity_in_systems(entity);
+    template<typename T>
+    void Entity_Command_Buffer::add_component(EntityID entity, T component) {
+        record({ Command_Type::ADD_COMPONENT, entity, ECS_Manager::get_component_id<T>(), std::string(),
+            [component = std::move(component)](ECS_Manager& ecs, EntityID target) {
+                ecs.insert_component<T>(target, component);
+            } });
     }
 
     template<typename T>
-    T& ECS_Manager::get_component(EntityID entity) {
-        std::type_index typeIndex(typeid(T));
+    void Entity_Command_Buffer::remove_component(EntityID entity) {
+        record({ Command_Type::REMOVE_COMPONENT, entity, ECS_Manager::get_component_id<T>(), std::string(),
+            [](ECS_Manager& ecs, EntityID target) {
+                ecs.erase_component<T>(target);
+            } });
+    }
 
-        // Ensure component type is registered
-        assert(component_type_to_id.find(typeIndex) != component_type_to_id.end() && "Component type not registered.");
+    template<typename T>
+    void Prefab_Template::Value<T>::insert_into(ECS_Manager& ecs, EntityID entity) const {
+        ecs.insert_component<T>(entity, value);
+    }
+
+    template<typename T>
+    void Prefab_Template::add_component(EntityID, T component) {
+        constexpr std::size_t id = ECS_Manager::get_component_id<T>();
+        values[id] = std::make_unique<Value<T>>(std::move(component));
+        mask.set(id);
+    }
 
+    template<typename T>
+    void Prefab_Template::remove_component(EntityID) {
+        constexpr std::size_t id = ECS_Manager::get_component_id<T>();
+        values[id].reset();
+        mask.reset(id);
+    }
+
+    template<typename T>
+    bool Prefab_Template::has_component(EntityID) const {
+        return mask.test(ECS_Manager::get_component_id<T>());
+    }
+
+    template<typename T>
+    T& ECS_Manager::get_component(EntityID entity) {
         // Ensure entity ID is valid
-        assert(entity < entities.size() && "Entity ID out of range.");
+        assert(is_alive(entity) && "Entity ID is invalid or stale.");
 
-        auto& componentArray = get_component_array<T>();
+        auto& pool = get_component_pool<T>();
 
         // Ensure the component exists on the entity
-        assert(componentArray[entity] && "Component not found on entity.");
+        assert(pool.has(entity) && "Component not found on entity.");
 
-        return *static_cast<T*>(componentArray[entity].get());
+        return pool.get(entity);
     }
 
     template<typename T>
     bool ECS_Manager::has_component(EntityID entity) const {
-        std::type_index typeIndex(typeid(T));
+        const auto& pool = component_pools[get_component_id<T>()];
 
         // Ensure component type is registered
-        if (component_type_to_id.find(typeIndex) == component_type_to_id.end()) {
+        if (!pool) {
             return false;
         }
 
         // Ensure entity ID is valid
-        assert(entity < entities.size() && "Entity ID out of range.");
+        assert(is_alive(entity) && "Entity ID is invalid or stale.");
+
+        return pool->has(entity);
+    }
+
+    template<typename T>
+    void ECS_Manager::mark_dirty(EntityID entity) {
+        // Ensure entity ID is valid
+        assert(is_alive(entity) && "Entity ID is invalid or stale.");
 
-        const auto& componentArray = component_arrays.at(typeIndex);
-        return componentArray[entity] != nullptr;
+        get_component_pool<T>().mark_dirty(entity);
     }
 
     template<typename T>
-    std::size_t ECS_Manager::get_component_id() const {
-        std::type_index typeIndex(typeid(T));
+    bool ECS_Manager::changed_since(EntityID entity, std::uint32_t tick) const {
+        const auto& pool = component_pools[get_component_id<T>()];
 
         // Ensure component type is registered
-        assert(component_type_to_id.find(typeIndex) != component_type_to_id.end() && "Component type not registered.");
+        assert(pool && "Component type not registered.");
 
-        return component_type_to_id.at(typeIndex);
+        return pool->changed_since(entity, tick);
+    }
+
+    template<typename T>
+    constexpr std::size_t ECS_Manager::get_component_id() {
+        return component_type_id<T>;
+    }
+
+    template<typename... Ts>
+    ECS_View<Ts...> ECS_Manager::view() {
+        return ECS_View<Ts...>(get_component_pool<std::remove_const_t<Ts>>()...);
+    }
+
+    template<typename T>
+    T* ECS_Manager::get_system() const {
+        for (const auto& system : systems) {
+            if (T* typed = dynamic_cast<T*>(system.get())) {
+                return typed;
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename T>
+    EntityID ECS_Manager::get_singleton() {
+        const std::vector<EntityID>& owners = get_component_pool<T>().get_entities();
+        return owners.empty() ? INVALID_ENTITY_ID : owners.front();
     }
 
     template<typename T>
-    std::vector<std::unique_ptr<Component>>& ECS_Manager::get_component_array() {
-        std::type_index typeIndex(typeid(T));
+    Component_Pool<T>& ECS_Manager::get_component_pool() {
+        constexpr std::size_t id = get_component_id<T>();
 
         // Ensure component type is registered
-        assert(component_arrays.find(typeIndex) != component_arrays.end() && "Component type not registered.");
+        assert(component_pools[id] && "Component type not registered.");
 
-        return component_arrays[typeIndex];
+        return *static_cast<Component_Pool<T>*>(component_pools[id].get());
     }
 
 } // namespace lof
@@ -0,0 +1,242 @@
+/**
+ * @file ECS_View.h
+ * @brief Defines the ECS_View class template for iterating entities over several component pools.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_ECS_VIEW_H
+#define LOF_ECS_VIEW_H
+
+// Include standard headers
+#include <tuple>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Include other necessary headers
+#include "../Component/Component_Pool.h"
+#include "../Utility/Type.h" // For EntityID
+
+namespace lof {
+
+    /**
+     * @class ECS_View
+     * @brief Resolves a set of component pools once and iterates the entities that own all of them.
+     * @details Obtain a view with ECSM.view<Ts...>() at the top of an update, then use each() or a
+     *          range-based for loop. Components are looked up by index into each pool, with no type
+     *          lookups per access. Components of the viewed types must not be added or removed
+     *          while iterating, since pools keep their components packed. Components of
+     *          non-const types are stamped as changed when accessed, so read-only types should be
+     *          const-qualified, as in view<Graphics_Component, const Transform2D>().
+     * @tparam Ts The component types of the view, const-qualified for read-only access.
+     */
+    template<typename... Ts>
+    class ECS_View {
+        static_assert(sizeof...(Ts) > 0, "ECS_View requires at least one component type.");
+
+    private:
+        std::tuple<Component_Pool<std::remove_const_t<Ts>>*...> pools; ///< The pools of each viewed component type
+
+        /**
+         * @brief Get the pool of a viewed component type.
+         * @return Pointer to the pool, ignoring the const qualifier of T.
+         */
+        template<typename T>
+        Component_Pool<std::remove_const_t<T>>* pool() const {
+            return std::get<Component_Pool<std::remove_const_t<T>>*>(pools);
+        }
+
+        /**
+         * @brief Access a component, stamping it as changed only for non-const types.
+         * @param entity The ID of the entity, which must own the component.
+         * @return Reference to the component, constant for const-qualified types.
+         */
+        template<typename T>
+        T& fetch(EntityID entity) const {
+            if constexpr (std::is_const_v<T>) {
+                return pool<T>()->read(entity);
+            }
+            else {
+                return pool<T>()->get(entity);
+            }
+        }
+
+        /**
+         * @brief Get the entity list of the smallest pool, used to drive iteration.
+         * @return Constant reference to the packed entity IDs of the smallest pool.
+         */
+        const std::vector<EntityID>& smallest_entities() const {
+            const std::vector<EntityID>* lists[] = { &pool<Ts>()->get_entities()... };
+            const std::vector<EntityID>* smallest = lists[0];
+            for (const std::vector<EntityID>* list : lists) {
+                if (list->size() < smallest->size()) {
+                    smallest = list;
+                }
+            }
+            return *smallest;
+        }
+
+    public:
+        /**
+         * @class iterator
+         * @brief Forward iterator over the entities owning every viewed component.
+         * @details Dereferencing yields a tuple of the entity ID and references to its components.
+         */
+        class iterator {
+        private:
+            const ECS_View* view;
+            std::vector<EntityID>::const_iterator current;
+            std::vector<EntityID>::const_iterator last;
+
+            // Skip entities missing any of the viewed components
+            void skip_unmatched() {
+                while (current != last && !view->contains(*current)) {
+                    ++current;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::tuple<EntityID, Ts&...>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            iterator(const ECS_View* view, std::vector<EntityID>::const_iterator current, std::vector<EntityID>::const_iterator last)
+                : view(view), current(current), last(last) {
+                skip_unmatched();
+            }
+
+            reference operator*() const {
+                return std::tuple_cat(std::make_tuple(*current), view->get(*current));
+            }
+
+            iterator& operator++() {
+                ++current;
+                skip_unmatched();
+                return *this;
+            }
+
+            bool operator==(const iterator& other) const {
+                return current == other.current;
+            }
+
+            bool operator!=(const iterator& other) const {
+                return current != other.current;
+            }
+        };
+
+        /**
+         * @brief Constructor for ECS_View.
+         * @param component_pools The pools of each viewed component type.
+         */
+        explicit ECS_View(Component_Pool<std::remove_const_t<Ts>>&... component_pools)
+            : pools(&component_pools...) {}
+
+        /**
+         * @brief Check if an entity owns every viewed component.
+         * @param entity The ID of the entity to check.
+         * @return True if all pools hold a component for the entity, false otherwise.
+         */
+        bool contains(EntityID entity) const {
+            return (pool<Ts>()->has(entity) && ...);
+        }
+
+        /**
+         * @brief Get the viewed components of an entity.
+         * @param entity The ID of the entity, which must own every viewed component.
+         * @return Tuple of references to the entity's components, in view order.
+         */
+        std::tuple<Ts&...> get(EntityID entity) const {
+            return std::tuple<Ts&...>(fetch<Ts>(entity)...);
+        }
+
+        /**
+         * @brief Call a function for every entity owning all viewed components.
+         * @details Iteration is driven by the smallest pool.
+         * @param fn Callable invoked as fn(EntityID, Ts&...).
+         */
+        template<typename Func>
+        void each(Func&& fn) const {
+            for (EntityID entity : smallest_entities()) {
+                if (contains(entity)) {
+                    fn(entity, fetch<Ts>(entity)...);
+                }
+            }
+        }
+
+        /**
+         * @brief Call a function for every entity in a list, such as a system's entities.
+         * @details Every entity in the list must own all viewed components, which holds for
+         *          a system whose signature includes the viewed types.
+         * @param entities The entity IDs to visit.
+         * @param fn Callable invoked as fn(EntityID, Ts&...).
+         */
+        template<typename Range, typename Func>
+        void each(const Range& entities, Func&& fn) const {
+            each(std::begin(entities), std::end(entities), std::forward<Func>(fn));
+        }
+
+        /**
+         * @brief Call a function for every entity in an iterator range, used to process a chunk of a list.
+         * @details Every entity in the range must own all viewed components.
+         * @param first Iterator to the first entity ID of the chunk.
+         * @param last Iterator past the last entity ID of the chunk.
+         * @param fn Callable invoked as fn(EntityID, Ts&...).
+         */
+        template<typename Iterator, typename Func>
+        void each(Iterator first, Iterator last, Func&& fn) const {
+            for (; first != last; ++first) {
+                EntityID entity = *first;
+                fn(entity, fetch<Ts>(entity)...);
+            }
+        }
+
+        /**
+         * @brief Check if any viewed component of an entity changed after a given tick.
+         * @param entity The ID of the entity, which must own every viewed component.
+         * @param tick The tick to compare against, usually the tick at which the caller last ran.
+         * @return True if any viewed component was added or written after the tick, false otherwise.
+         */
+        bool changed_since(EntityID entity, std::uint32_t tick) const {
+            return (pool<Ts>()->changed_since(entity, tick) || ...);
+        }
+
+        /**
+         * @brief Call a function for every entity in a list whose viewed components changed after a tick.
+         * @details Unchanged entities cost one version compare per viewed component and are not
+         *          stamped. Every entity in the list must own all viewed components.
+         * @param entities The entity IDs to visit.
+         * @param tick The tick to compare against.
+         * @param fn Callable invoked as fn(EntityID, Ts&...).
+         */
+        template<typename Range, typename Func>
+        void each_changed(const Range& entities, std::uint32_t tick, Func&& fn) const {
+            for (EntityID entity : entities) {
+                if (changed_since(entity, tick)) {
+                    fn(entity, fetch<Ts>(entity)...);
+                }
+            }
+        }
+
+        iterator begin() const {
+            const std::vector<EntityID>& list = smallest_entities();
+            return iterator(this, list.begin(), list.end());
+        }
+
+        iterator end() const {
+            const std::vector<EntityID>& list = smallest_entities();
+            return iterator(this, list.end(), list.end());
+        }
+    };
+
+} // namespace lof
+
+#endif // LOF_ECS_VIEW_H
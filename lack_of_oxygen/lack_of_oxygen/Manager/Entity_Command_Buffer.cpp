@@ -0,0 +1,136 @@
+/**
+ * @file Entity_Command_Buffer.cpp
+ * @brief Implements the Entity_Command_Buffer class for deferring structural changes in the ECS.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Entity_Command_Buffer.h"
+
+// Include other necessary headers
+#include "ECS_Manager.h"
+#include "Log_Manager.h"
+
+// Include standard headers
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace lof {
+
+    bool Entity_Command_Buffer::is_pending(EntityID entity) {
+        return entity != INVALID_ENTITY_ID && entity_generation(entity) == PENDING_ENTITY_GENERATION;
+    }
+
+    void Entity_Command_Buffer::record(Command command) {
+        std::lock_guard<std::mutex> lock(record_mutex);
+        commands.push_back(std::move(command));
+    }
+
+    EntityID Entity_Command_Buffer::create_entity(const std::string& name) {
+        std::lock_guard<std::mutex> lock(record_mutex);
+        EntityID pending = make_entity_id(pending_count++, PENDING_ENTITY_GENERATION);
+        commands.push_back({ Command_Type::CREATE, pending, 0, name, nullptr });
+        return pending;
+    }
+
+    void Entity_Command_Buffer::destroy_entity(EntityID entity) {
+        record({ Command_Type::DESTROY, entity, 0, std::string(), nullptr });
+    }
+
+    void Entity_Command_Buffer::flush(ECS_Manager& ecs) {
+        if (commands.empty()) {
+            return;
+        }
+
+        // Take the commands so that anything recorded during playback waits for the next flush
+        std::vector<Command> playback;
+        std::uint32_t created_count;
+        {
+            std::lock_guard<std::mutex> lock(record_mutex);
+            playback.swap(commands);
+            created_count = pending_count;
+            pending_count = 0;
+        }
+
+        // Create pending entities in recording order
+        std::vector<EntityID> created(created_count, INVALID_ENTITY_ID);
+        for (const Command& command : playback) {
+            if (command.type == Command_Type::CREATE) {
+                created[entity_index(command.entity)] = ecs.create_entity(command.name);
+            }
+        }
+
+        // Resolve every remaining command to its real entity and group by entity
+        std::vector<EntityID> targets(playback.size(), INVALID_ENTITY_ID);
+        std::vector<std::size_t> order;
+        order.reserve(playback.size());
+        for (std::size_t i = 0; i < playback.size(); ++i) {
+            if (playback[i].type == Command_Type::CREATE) {
+                continue;
+            }
+            EntityID entity = playback[i].entity;
+            targets[i] = is_pending(entity) ? created[entity_index(entity)] : entity;
+            order.push_back(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [&targets](std::size_t a, std::size_t b) {
+            return targets[a] < targets[b];
+        });
+
+        constexpr std::size_t NO_COMMAND = std::numeric_limits<std::size_t>::max();
+        std::array<std::size_t, MAX_COMPONENTS> last_change;
+
+        for (std::size_t begin = 0; begin < order.size();) {
+            EntityID entity = targets[order[begin]];
+            std::size_t end = begin;
+            bool destroy = false;
+            while (end < order.size() && targets[order[end]] == entity) {
+                destroy = destroy || playback[order[end]].type == Command_Type::DESTROY;
+                ++end;
+            }
+
+            if (!ecs.is_alive(entity)) {
+                LM.write_log("Entity_Command_Buffer::flush(): Skipping commands for invalid or destroyed entity %u.", entity);
+            }
+            else if (destroy) {
+                ecs.destroy_entity(entity);
+            }
+            else {
+                // Only the last change to each component takes effect
+                last_change.fill(NO_COMMAND);
+                for (std::size_t i = begin; i < end; ++i) {
+                    last_change[playback[order[i]].component_id] = order[i];
+                }
+                ComponentMask changed;
+                for (std::size_t i = begin; i < end; ++i) {
+                    const Command& command = playback[order[i]];
+                    if (last_change[command.component_id] == order[i]) {
+                        command.apply(ecs, entity);
+                        changed.set(command.component_id);
+                    }
+                }
+
+                ecs.update_entity_in_systems(entity, changed);
+            }
+
+            begin = end;
+        }
+
+        LM.write_log("Entity_Command_Buffer::flush(): Played back %zu commands.", playback.size());
+    }
+
+    bool Entity_Command_Buffer::empty() const {
+        return commands.empty();
+    }
+
+    void Entity_Command_Buffer::clear() {
+        std::lock_guard<std::mutex> lock(record_mutex);
+        commands.clear();
+        pending_count = 0;
+    }
+
+} // namespace lof
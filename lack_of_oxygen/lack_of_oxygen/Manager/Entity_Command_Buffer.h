@@ -0,0 +1,129 @@
+/**
+ * @file Entity_Command_Buffer.h
+ * @brief Declares the Entity_Command_Buffer class for deferring structural changes in the ECS.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_ENTITY_COMMAND_BUFFER_H
+#define LOF_ENTITY_COMMAND_BUFFER_H
+
+// Include standard headers
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+// Include other necessary headers
+#include "../Utility/Type.h" // For EntityID
+
+namespace lof {
+
+    class ECS_Manager;
+
+    /**
+     * @class Entity_Command_Buffer
+     * @brief Records entity creation, destruction and component changes to be played back later.
+     * @details Systems record structural changes here instead of applying them while other systems
+     *          may be iterating their entity lists. The ECS_Manager plays the buffer back at its sync
+     *          points. Commands are grouped per entity, a destroy overrides every other change to the
+     *          same entity, only the last change to each component is applied, and system membership
+     *          is re-evaluated once per entity. The template members are defined in ECS_Manager.h,
+     *          since they need the complete ECS_Manager.
+     */
+    class Entity_Command_Buffer {
+    private:
+        /**
+         * @enum Command_Type
+         * @brief The kind of structural change recorded by a command.
+         */
+        enum class Command_Type {
+            CREATE,
+            DESTROY,
+            ADD_COMPONENT,
+            REMOVE_COMPONENT
+        };
+
+        /**
+         * @struct Command
+         * @brief A single recorded structural change.
+         */
+        struct Command {
+            Command_Type type;                                   ///< Kind of change
+            EntityID entity;                                     ///< Target entity, or a pending entity from create_entity()
+            std::size_t component_id;                            ///< Component ID for component changes
+            std::string name;                                    ///< Entity name for creation
+            std::function<void(ECS_Manager&, EntityID)> apply;   ///< Applies a component change without updating systems
+        };
+
+        std::vector<Command> commands;   ///< Recorded commands in recording order
+        std::uint32_t pending_count = 0; ///< Number of entities created since the last flush
+        std::mutex record_mutex;         ///< Guards recording from systems updating on worker threads
+
+        /**
+         * @brief Append a command to the buffer.
+         * @param command The command to record.
+         */
+        void record(Command command);
+
+        /**
+         * @brief Check if an ID is a pending entity returned by create_entity().
+         * @param entity The ID to check.
+         * @return True if the ID refers to an entity not yet created, false otherwise.
+         */
+        static bool is_pending(EntityID entity);
+
+    public:
+        /**
+         * @brief Record the creation of an entity.
+         * @param name Optional name for the entity.
+         * @return A pending entity ID, usable with this buffer only until the next flush.
+         */
+        EntityID create_entity(const std::string& name = "");
+
+        /**
+         * @brief Record the destruction of an entity.
+         * @param entity The ID of the entity to destroy.
+         */
+        void destroy_entity(EntityID entity);
+
+        /**
+         * @brief Record adding a component to an entity.
+         * @param entity The ID of the entity, which may be pending.
+         * @param component The component value to add.
+         */
+        template<typename T>
+        void add_component(EntityID entity, T component);
+
+        /**
+         * @brief Record removing a component from an entity.
+         * @param entity The ID of the entity, which may be pending.
+         */
+        template<typename T>
+        void remove_component(EntityID entity);
+
+        /**
+         * @brief Play back and clear every recorded command.
+         * @param ecs The ECS_Manager to apply the commands to.
+         */
+        void flush(ECS_Manager& ecs);
+
+        /**
+         * @brief Check if no commands are recorded.
+         * @return True if the buffer is empty, false otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Discard every recorded command without applying it.
+         */
+        void clear();
+    };
+
+} // namespace lof
+
+#endif // LOF_ENTITY_COMMAND_BUFFER_H
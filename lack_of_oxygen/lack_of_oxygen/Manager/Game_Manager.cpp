@@ -18,6 +18,7 @@
 #include "Serialization_Manager.h"
 #include "Input_Manager.h"
 #include "Graphics_Manager.h"
+#include "Job_Manager.h"
 
 // Include utility
 #include "../Utility/Constant.h"
@@ -61,9 +62,19 @@ namespace lof {
             LM.write_log("Game_Manager::start_up(): Log_Manager start_up() successful");
         }
 
+        // -------------------------- Job Manager Start Up --------------------------
+        if (JM.start_up() != 0) {
+            // Not fatal, jobs run on the main thread when the Job_Manager is not started
+            LM.write_log("Game_Manager::start_up(): Job_Manager start_up() failed, systems will update on the main thread");
+        }
+        else {
+            LM.write_log("Game_Manager::start_up(): Job_Manager start_up() successful");
+        }
+
         // -------------------------- ECS Manager Start Up --------------------------
         if (ECSM.start_up() != 0) {
             LM.write_log("Game_Manager::start_up(): ECS_Manager start_up() failed");
+            JM.shut_down();
             LM.shut_down();
             return -2;
         }
@@ -75,6 +86,7 @@ namespace lof {
         if (SM.start_up() != 0) {
             LM.write_log("Game_Manager::start_up(): Serialization_Manager start_up() failed");
             ECSM.shut_down();
+            JM.shut_down();
             LM.shut_down();
             return -3;
         }
@@ -87,6 +99,7 @@ namespace lof {
             LM.write_log("Game_Manager::start_up(): FPS_Manager start_up() failed");
             SM.shut_down();
             ECSM.shut_down();
+            JM.shut_down();
             LM.shut_down();
             return -4;
         }
@@ -100,6 +113,7 @@ namespace lof {
             FPSM.shut_down();
             SM.shut_down();
             ECSM.shut_down();
+            JM.shut_down();
             LM.shut_down();
             return -5;
         }
@@ -114,6 +128,7 @@ namespace lof {
             FPSM.shut_down();
             SM.shut_down();
             ECSM.shut_down();
+            JM.shut_down();
             LM.shut_down();
             return -7;
         }
@@ -139,6 +154,7 @@ namespace lof {
         FPSM.shut_down(); // FPS_Manager
         SM.shut_down();   // Serialization_Manager
         ECSM.shut_down(); // ECS_Manager
+        JM.shut_down();   // Job_Manager
         LM.shut_down();   // Log_Manager
 
         m_is_started = false;
@@ -233,6 +249,20 @@ namespace lof {
             }
         }
 
+        // Rewind and replay recorded snapshots while the level editor is active
+        if (level_editor_mode) {
+            if (IM.is_key_pressed(GLFW_KEY_LEFT_BRACKET)) {
+                if (ECSM.get_snapshot_buffer().step_back(ECSM)) {
+                    LM.write_log("Game_Manager::update(): '[' key pressed, rewound one snapshot.");
+                }
+            }
+            else if (IM.is_key_pressed(GLFW_KEY_RIGHT_BRACKET)) {
+                if (ECSM.get_snapshot_buffer().step_forward(ECSM)) {
+                    LM.write_log("Game_Manager::update(): ']' key pressed, replayed one snapshot.");
+                }
+            }
+        }
+
         //to pause all the sound that is playing
         if (IM.is_key_pressed(GLFW_KEY_KP_5)) {
             for (auto& system : ECSM.get_systems()) {
@@ -246,9 +276,9 @@ namespace lof {
         }
 
         // Handle player movement and physics input
-        EntityID player_id = ECSM.find_entity_by_name(DEFAULT_PLAYER_NAME);
+        EntityID player_id = ECSM.get_singleton<Player_Tag>();
 
-        if (player_id != 0) {  // If player entity exists
+        if (player_id != INVALID_ENTITY_ID) {  // If player entity exists
             if (ECSM.has_component<Physics_Component>(player_id)) {
 
                 auto& physics = ECSM.get_component<Physics_Component>(player_id);
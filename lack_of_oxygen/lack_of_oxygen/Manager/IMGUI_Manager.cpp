@@ -187,7 +187,9 @@ namespace lof {
         const auto& entities = ecs.get_entities();
 
 
-        if (selected_object_index >= entities.size()) {
+        // Destroyed entities leave an empty slot behind, so drop the selection if it was freed
+        if (selected_object_index >= entities.size() ||
+            (selected_object_index >= 0 && !entities[selected_object_index])) {
             selected_object_index = -1;
         }
 
@@ -358,6 +360,16 @@ namespace lof {
                     std::string s_label = "is_static: " + std::string(is_static_on ? "On" : "Off");
                     if (button_toggle(s_label, &is_static_on)) {
                         is_static = !is_static;
+
+                        // Keep the tag in step so systems excluding static entities pick up the change
+                        // at the next sync point
+                        EntityID physics_entity = entities[selected_object_index]->get_id();
+                        if (is_static) {
+                            ecs.get_command_buffer().add_component<Static_Tag>(physics_entity, Static_Tag());
+                        }
+                        else {
+                            ecs.get_command_buffer().remove_component<Static_Tag>(physics_entity);
+                        }
                     }
 
                     auto& is_grounded = physics.get_is_grounded();
@@ -414,7 +426,7 @@ namespace lof {
 
                 if (!filled) {
 
-                    auto& animation_list = animation.animations;
+                    const auto& animation_list = animation.animations.get();
                     for (const auto& it : animation_list) {
                         assigned_names.push_back(it.second);
                     }
@@ -430,7 +442,7 @@ namespace lof {
                         animation_names_c_str.push_back(name.c_str());
                     }
 
-                    auto& animation_list = animation.animations;
+                    const auto& animation_list = animation.animations.get();
                     static std::vector<int> selected_items(animation_list.size(), -1);
                     int index = 0;
                     for (auto it = animation_list.begin(); it != animation_list.end(); ++it, ++index) {
@@ -444,7 +456,8 @@ namespace lof {
 
                             // Update the specific animation in the list
                             if (selected_items[index] >= 0 && selected_items[index] < assigned_names.size()) {
-                                it->second = assigned_names[selected_items[index]];
+                                // Only the edited entity gets its own copy of the list
+                                animation.animations.write()[it->first] = assigned_names[selected_items[index]];
                             }
                         }
                     }
@@ -602,10 +615,14 @@ namespace lof {
     void IMGUI_Manager::remove_game_objects(int index) {
 
         const auto& entities = ecs.get_entities();
+        if (index < 0 || index >= static_cast<int>(entities.size()) || !entities[index]) {
+            return;
+        }
         EntityID eid = entities[index]->get_id();
 
+        // Destroyed at the next sync point, so the entity list stays valid for the rest of the frame
         if (eid != INVALID_ENTITY_ID) {
-            ECSM.destroy_entity(eid);
+            ECSM.get_command_buffer().destroy_entity(eid);
             remove_game_obj = !remove_game_obj;
             return;
         }
@@ -613,10 +630,10 @@ namespace lof {
         
     }
 
-    void IMGUI_Manager::text_input(std::string& data_name, std::string& codition_name) {
+    void IMGUI_Manager::text_input(Shared_Value<std::string>& data_name, std::string& codition_name) {
 
         char Buffer[128]; //add to constant.h
-        strncpy_s(Buffer, data_name.c_str(), sizeof(Buffer));//s is safer
+        strncpy_s(Buffer, data_name->c_str(), sizeof(Buffer));//s is safer
         Buffer[sizeof(Buffer) - 1] = '\0';
 
         if (ImGui::InputText(codition_name.c_str(), Buffer, sizeof(Buffer))) {
@@ -22,6 +22,9 @@
 #include "../IMGUI/imgui_impl_glfw.h"
 #include "../IMGUI/imgui_impl_opengl3.h"
 
+// Include utility headers
+#include "../Utility/Shared_Value.h"
+
 // Include standard headers
 #include <string>
 #include <fstream>
@@ -128,7 +131,7 @@ namespace lof {
          * @param data_name Reference to a string containing the current text data of the the object's condition.
          * @param codition_name Reference to a string containing the name of the condition.
          */
-        void text_input(std::string& data_name, std::string& codition_name);
+        void text_input(Shared_Value<std::string>& data_name, std::string& codition_name);
 
         /**
          * @brief Pushes back the prefab_name string to the prefab_names vector.
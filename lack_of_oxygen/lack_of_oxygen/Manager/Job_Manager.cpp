@@ -0,0 +1,199 @@
+/**
+ * @file Job_Manager.cpp
+ * @brief Implements the Job_Manager class for running jobs on a pool of worker threads.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+// Include header file
+#include "Job_Manager.h"
+
+// Include other managers
+#include "Log_Manager.h"
+
+// Include utility function
+#include "../Utility/Constant.h"
+
+// Include standard headers
+#include <algorithm>
+
+namespace lof {
+
+    namespace {
+        // Index of the worker running on this thread, NO_WORKER on every other thread
+        constexpr std::size_t NO_WORKER = static_cast<std::size_t>(-1);
+        thread_local std::size_t current_worker = NO_WORKER;
+    }
+
+    Job_Manager::Job_Manager()
+        : queued_count(0), next_queue(0), stopping(false) {
+        set_type("Job_Manager");
+        m_is_started = false;
+    }
+
+    Job_Manager& Job_Manager::get_instance() {
+        static Job_Manager instance;
+        return instance;
+    }
+
+    int Job_Manager::start_up() {
+        if (is_started()) {
+            LM.write_log("Job_Manager::start_up(): Already started.");
+            return 0; // Already started
+        }
+
+        // Leave one hardware thread for the main thread
+        unsigned int hardware_threads = std::thread::hardware_concurrency();
+        unsigned int worker_count = hardware_threads > 1 ? hardware_threads - 1 : 1;
+        worker_count = std::min(worker_count, DEFAULT_MAX_WORKER_THREADS);
+
+        // Create every deque before any worker can try to steal from it
+        stopping = false;
+        queued_count = 0;
+        for (unsigned int i = 0; i < worker_count; ++i) {
+            queues.push_back(std::make_unique<Worker_Queue>());
+        }
+
+        m_is_started = true;
+        try {
+            for (unsigned int i = 0; i < worker_count; ++i) {
+                workers.emplace_back(&Job_Manager::worker_loop, this, static_cast<std::size_t>(i));
+            }
+        }
+        catch (const std::exception& e) {
+            LM.write_log("Job_Manager::start_up(): Failed to spawn worker threads. Error: %s", e.what());
+            shut_down();
+            return -1;
+        }
+
+        LM.write_log("Job_Manager::start_up(): Job_Manager started with %u worker threads.", worker_count);
+        return 0;
+    }
+
+    void Job_Manager::shut_down() {
+        if (!is_started()) {
+            LM.write_log("Job_Manager::shut_down(): Job_Manager is not started.");
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        sleep_cv.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+        queues.clear();
+
+        m_is_started = false;
+        LM.write_log("Job_Manager::shut_down(): Job_Manager shut down successfully.");
+    }
+
+    void Job_Manager::submit(std::function<void()> function, Job_Counter& counter) {
+        counter.remaining.fetch_add(1, std::memory_order_relaxed);
+
+        Job job{ std::move(function), &counter };
+
+        // Run inline when there are no workers to hand the job to
+        if (!is_started() || queues.empty()) {
+            run_job(job);
+            return;
+        }
+
+        // Workers keep their own jobs, other threads spread jobs across the workers
+        std::size_t target = current_worker != NO_WORKER ? current_worker : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        {
+            std::lock_guard<std::mutex> lock(queues[target]->mutex);
+            queues[target]->jobs.push_back(std::move(job));
+        }
+        queued_count.fetch_add(1, std::memory_order_release);
+
+        // Taking the lock orders the notify after any worker's predicate check
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+        }
+        sleep_cv.notify_one();
+    }
+
+    void Job_Manager::wait(Job_Counter& counter) {
+        Job job;
+        while (counter.remaining.load(std::memory_order_acquire) > 0) {
+            // Help with queued work instead of idling
+            if (try_pop(job)) {
+                run_job(job);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::size_t Job_Manager::get_worker_count() const {
+        return workers.size();
+    }
+
+    void Job_Manager::worker_loop(std::size_t index) {
+        current_worker = index;
+
+        Job job;
+        while (true) {
+            if (try_pop(job)) {
+                run_job(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleep_cv.wait(lock, [this]() { return stopping || queued_count.load(std::memory_order_acquire) > 0; });
+
+            // Finish every queued job before stopping
+            if (stopping && queued_count.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    void Job_Manager::run_job(Job& job) {
+        job.function();
+        job.counter->remaining.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool Job_Manager::try_pop(Job& job) {
+        std::size_t count = queues.size();
+        if (count == 0 || queued_count.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        // Take the newest job from our own deque
+        if (current_worker != NO_WORKER) {
+            Worker_Queue& own = *queues[current_worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.jobs.empty()) {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                queued_count.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // Steal the oldest job from another deque
+        std::size_t start = current_worker != NO_WORKER ? current_worker + 1 : 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            Worker_Queue& victim = *queues[(start + i) % count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty()) {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                queued_count.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+} // namespace lof
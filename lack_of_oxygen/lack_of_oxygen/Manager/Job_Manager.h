@@ -0,0 +1,179 @@
+/**
+ * @file Job_Manager.h
+ * @brief Defines the Job_Manager class for running jobs on a pool of worker threads.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_JOB_MANAGER_H
+#define LOF_JOB_MANAGER_H
+
+// Macros for accessing manager singleton instances
+#define JM lof::Job_Manager::get_instance()
+
+// Include base Manager class
+#include "Manager.h"
+
+// Include standard headers
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lof {
+
+    /**
+     * @struct Job_Counter
+     * @brief Tracks the number of unfinished jobs submitted against it.
+     */
+    struct Job_Counter {
+        std::atomic<int> remaining{ 0 }; ///< Jobs submitted but not yet finished
+    };
+
+    /**
+     * @class Job_Manager
+     * @brief Runs jobs on a fixed pool of worker threads with work stealing.
+     *
+     * This class is implemented as a singleton. Each worker owns a deque of jobs, taking its own
+     * jobs from the back and stealing from the front of other workers' deques when it runs out.
+     * Jobs submitted by a worker go to its own deque, jobs submitted by other threads are spread
+     * across the workers. Jobs are submitted with a Job_Counter and the submitting thread waits on
+     * that counter, running queued jobs itself while it waits. When the manager is not started,
+     * jobs run immediately on the submitting thread.
+     */
+    class Job_Manager : public Manager {
+    private:
+        /**
+         * @struct Job
+         * @brief A queued unit of work and the counter it reports to.
+         */
+        struct Job {
+            std::function<void()> function;
+            Job_Counter* counter;
+        };
+
+        /**
+         * @struct Worker_Queue
+         * @brief The job deque owned by one worker.
+         */
+        struct Worker_Queue {
+            std::deque<Job> jobs;
+            std::mutex mutex;
+        };
+
+        std::vector<std::thread> workers;                       // Worker threads
+        std::vector<std::unique_ptr<Worker_Queue>> queues;      // Job deque of each worker
+        std::atomic<int> queued_count;                          // Jobs waiting in any deque
+        std::atomic<std::size_t> next_queue;                    // Round-robin target for external submissions
+        std::mutex sleep_mutex;                                 // Guards sleeping and stopping
+        std::condition_variable sleep_cv;                       // Wakes idle workers when jobs are queued
+        bool stopping;                                          // True while the workers are being joined
+
+        Job_Manager();                                          // Private since a singleton.
+
+        /**
+         * @brief Main loop of each worker thread.
+         * @param index The index of the worker and its deque.
+         */
+        void worker_loop(std::size_t index);
+
+        /**
+         * @brief Run a job and report its completion to its counter.
+         * @param job The job to run.
+         */
+        static void run_job(Job& job);
+
+        /**
+         * @brief Take a job, from the calling worker's own deque first, then from the other deques.
+         * @param job Output for the job taken.
+         * @return True if a job was taken, false if every deque is empty.
+         */
+        bool try_pop(Job& job);
+
+    public:
+        /**
+         * @brief Get the singleton instance of the Job_Manager.
+         * @return Reference to the Job_Manager instance.
+         */
+        static Job_Manager& get_instance();
+
+        // Delete copy constructor and assignment operator
+        Job_Manager(const Job_Manager&) = delete;
+        Job_Manager& operator=(const Job_Manager&) = delete;
+
+        /**
+         * @brief Start up the Job_Manager and spawn the worker threads.
+         * @return 0 if successful, else negative number.
+         */
+        int start_up() override;
+
+        /**
+         * @brief Shut down the Job_Manager, finishing queued jobs and joining the workers.
+         */
+        void shut_down() override;
+
+        /**
+         * @brief Queue a job to run on a worker thread.
+         * @param function The work to run.
+         * @param counter The counter to wait on for this job.
+         */
+        void submit(std::function<void()> function, Job_Counter& counter);
+
+        /**
+         * @brief Block until every job submitted against a counter has finished.
+         * @details The calling thread runs queued jobs while it waits.
+         * @param counter The counter to wait on.
+         */
+        void wait(Job_Counter& counter);
+
+        /**
+         * @brief Split the index range [0, count) into chunks and process them concurrently.
+         * @details Returns once every chunk is done. Chunks hold at most grain indices, and small
+         *          ranges run on the calling thread. fn must only write data owned by its chunk.
+         * @param count The number of indices to process.
+         * @param grain The maximum number of indices per chunk.
+         * @param fn Callable invoked as fn(first, last) for each chunk.
+         */
+        template<typename Func>
+        void parallel_for(std::size_t count, std::size_t grain, Func&& fn);
+
+        /**
+         * @brief Get the number of worker threads.
+         * @return The number of worker threads, 0 if the manager is not started.
+         */
+        std::size_t get_worker_count() const;
+    };
+
+    template<typename Func>
+    void Job_Manager::parallel_for(std::size_t count, std::size_t grain, Func&& fn) {
+        if (grain == 0) {
+            grain = 1;
+        }
+
+        // Not worth splitting, or no workers to split across
+        if (count <= grain || !is_started()) {
+            if (count > 0) {
+                fn(std::size_t{ 0 }, count);
+            }
+            return;
+        }
+
+        Job_Counter counter;
+        for (std::size_t first = 0; first < count; first += grain) {
+            std::size_t last = std::min(first + grain, count);
+            submit([&fn, first, last]() { fn(first, last); }, counter);
+        }
+        wait(counter);
+    }
+
+} // namespace lof
+
+#endif // LOF_JOB_MANAGER_H
@@ -131,6 +131,7 @@ namespace lof {
         }
 
         // Write the timestamped log entry
+        std::lock_guard<std::mutex> lock(write_mutex);
         log_file << time_stream.str() << buffer << std::endl;
 
         if (do_flush) {
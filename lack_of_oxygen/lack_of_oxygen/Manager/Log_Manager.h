@@ -21,6 +21,7 @@
 #include <string>
 #include <fstream>
 #include <memory>
+#include <mutex>
 
 // Include Utility headers
 #include "../Utility/Clock.h"
@@ -36,6 +37,7 @@ namespace lof {
 
         bool do_flush;
         std::ofstream log_file;
+        std::mutex write_mutex;       //< Serializes writes from worker threads
         std::string log_file_name;
         Clock clock;                  //< Clock instance to track elapsed time since start
 
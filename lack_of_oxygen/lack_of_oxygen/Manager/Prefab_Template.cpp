@@ -0,0 +1,31 @@
+/**
+ * @file Prefab_Template.cpp
+ * @brief Implements the Prefab_Template class holding the parsed components of a prefab.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Prefab_Template.h"
+
+// Include other necessary headers
+#include "ECS_Manager.h"
+
+namespace lof {
+
+    const ComponentMask& Prefab_Template::get_mask() const {
+        return mask;
+    }
+
+    void Prefab_Template::instantiate(ECS_Manager& ecs, EntityID entity) const {
+        for (std::size_t id = 0; id < values.size(); ++id) {
+            if (mask.test(id)) {
+                values[id]->insert_into(ecs, entity);
+            }
+        }
+    }
+
+} // namespace lof
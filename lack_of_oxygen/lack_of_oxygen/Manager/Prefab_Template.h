@@ -0,0 +1,109 @@
+/**
+ * @file Prefab_Template.h
+ * @brief Declares the Prefab_Template class holding the parsed components of a prefab.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_PREFAB_TEMPLATE_H
+#define LOF_PREFAB_TEMPLATE_H
+
+// Include standard headers
+#include <array>
+#include <memory>
+
+// Include other necessary headers
+#include "../Utility/Type.h" // For EntityID and ComponentMask
+
+namespace lof {
+
+    class ECS_Manager;
+
+    /**
+     * @class Prefab_Template
+     * @brief Typed component values of a prefab, compiled once from its JSON definition.
+     * @details The Component_Parser fills a template the same way it fills an entity, so a prefab's
+     *          JSON is only parsed when the prefab file is loaded. Instantiating copies each value
+     *          straight into its component pool. The template members are defined in ECS_Manager.h,
+     *          since they need the complete ECS_Manager.
+     */
+    class Prefab_Template {
+    private:
+        /**
+         * @struct Value_Base
+         * @brief Type-erased component value.
+         */
+        struct Value_Base {
+            virtual ~Value_Base() = default;
+
+            /**
+             * @brief Copy the value onto an entity without updating the systems.
+             * @param ecs The ECS_Manager owning the entity.
+             * @param entity The ID of the entity receiving the component.
+             */
+            virtual void insert_into(ECS_Manager& ecs, EntityID entity) const = 0;
+        };
+
+        /**
+         * @struct Value
+         * @brief Component value of type T.
+         */
+        template<typename T>
+        struct Value : Value_Base {
+            T value;
+
+            explicit Value(T component) : value(std::move(component)) {}
+
+            void insert_into(ECS_Manager& ecs, EntityID entity) const override;
+        };
+
+        ComponentMask mask;                                              ///< Component types in the template
+        std::array<std::unique_ptr<Value_Base>, MAX_COMPONENTS> values;  ///< Value of each component type, indexed by component ID
+
+    public:
+        /**
+         * @brief Set the value of a component type, replacing any previous value.
+         * @details Takes an entity like ECS_Manager::add_component() so the Component_Parser can fill
+         *          either. The entity is ignored.
+         * @param entity Unused.
+         * @param component The component value.
+         */
+        template<typename T>
+        void add_component(EntityID entity, T component);
+
+        /**
+         * @brief Remove a component type from the template.
+         * @param entity Unused.
+         */
+        template<typename T>
+        void remove_component(EntityID entity);
+
+        /**
+         * @brief Check if the template has a component type.
+         * @param entity Unused.
+         * @return True if the template holds a value of type T.
+         */
+        template<typename T>
+        bool has_component(EntityID entity) const;
+
+        /**
+         * @brief Get the component types in the template.
+         * @return The template's component mask.
+         */
+        const ComponentMask& get_mask() const;
+
+        /**
+         * @brief Copy every component value onto an entity without updating the systems.
+         * @details The caller updates system membership once afterwards.
+         * @param ecs The ECS_Manager owning the entity.
+         * @param entity The ID of the entity receiving the components.
+         */
+        void instantiate(ECS_Manager& ecs, EntityID entity) const;
+    };
+
+} // namespace lof
+
+#endif // LOF_PREFAB_TEMPLATE_H
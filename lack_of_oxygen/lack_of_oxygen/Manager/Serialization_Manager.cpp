@@ -28,6 +28,7 @@
 
 // Include all component headers
 #include "../Component/Component.h"
+#include "../System/Collision_System.h" // Baking the level geometry
 
 // Include Utility headers
 #include "../Utility/Matrix3x3.h"
@@ -113,6 +114,7 @@ namespace lof {
         LM.write_log("Serialization_Manager::shut_down(): Shutting down Serialization_Manager.");
         m_document.SetNull();           // Clear the document
         m_prefab_map.clear();           // Clear the prefab cache
+        m_prefab_templates.clear();     // Clear the compiled prefabs
         m_is_started = false;
     }
 
@@ -264,6 +266,16 @@ namespace lof {
             rapidjson::Value prefab_value(rapidjson::kObjectType);
             prefab_value.CopyFrom(it->value, m_document.GetAllocator());
 
+            // Parse the components once so that clones only copy them
+            Prefab_Template prefab_template;
+            if (prefab_value.HasMember("components") && prefab_value["components"].IsObject()) {
+                Component_Parser::add_components_from_json(prefab_template, INVALID_ENTITY_ID, prefab_value["components"]);
+            }
+            else {
+                LM.write_log("Serialization_Manager::load_prefabs(): Prefab '%s' does not have a valid components object.", prefab_name.c_str());
+            }
+            m_prefab_templates.insert_or_assign(prefab_name, std::move(prefab_template));
+
             m_prefab_map.emplace(prefab_name, std::move(prefab_value));
             LM.write_log("Serialization_Manager::load_prefabs(): Loaded prefab '%s' into cache.", prefab_name.c_str());
         }
@@ -289,13 +301,13 @@ namespace lof {
         // Collect all existing entity IDs
         for (size_t i = 0; i < entities.size(); ++i) {
             if (entities[i]) {  // Check if entity exists
-                entities_to_remove.push_back(static_cast<EntityID>(i));
+                entities_to_remove.push_back(entities[i]->get_id());
             }
         }
 
-        // Remove all existing entities
-        for (EntityID eid : entities_to_remove) {
-            ECSM.destroy_entity(0);
+        // Remove all existing entities in reverse so that the lowest slots are reused first
+        for (auto it = entities_to_remove.rbegin(); it != entities_to_remove.rend(); ++it) {
+            ECSM.destroy_entity(*it);
         }
 
         LM.write_log("Serialization_Manager::load_scene(): Cleared %zu existing entities.", entities_to_remove.size());
@@ -360,30 +372,54 @@ namespace lof {
                 LM.write_log("Serialization_Manager::load_scene(): Created entity '%s' with ID %u.", entity_name.c_str(), eid);
             }
 
-            // Initialize merged components
-            rapidjson::Document::AllocatorType& allocator = m_document.GetAllocator();
-            rapidjson::Value merged_components(rapidjson::kObjectType);
+            // Prefab-based entities already hold the prefab's components, so only parse the components
+            // the scene overrides, each merged over the prefab's version of that component
+            if (obj.HasMember("components") && obj["components"].IsObject()) {
+                const rapidjson::Value& scene_components = obj["components"];
+                const rapidjson::Value* prefab_components = nullptr;
+                if (obj.HasMember("prefab") && obj["prefab"].IsString()) {
+                    auto prefab_it = m_prefab_map.find(obj["prefab"].GetString());
+                    if (prefab_it != m_prefab_map.end() && prefab_it->second.HasMember("components") && prefab_it->second["components"].IsObject()) {
+                        prefab_components = &prefab_it->second["components"];
+                    }
+                }
 
-            // If this is a prefab-based entity, start with the prefab's components
-            if (obj.HasMember("prefab") && obj["prefab"].IsString()) {
-                std::string prefab_name = obj["prefab"].GetString();
-                auto prefab_it = m_prefab_map.find(prefab_name);
-                if (prefab_it != m_prefab_map.end()) {
-                    const rapidjson::Value& prefab = prefab_it->second;
-                    if (prefab.HasMember("components") && prefab["components"].IsObject()) {
-                        merged_components.CopyFrom(prefab["components"], allocator);
+                if (prefab_components) {
+                    rapidjson::Document overrides(rapidjson::kObjectType);
+                    rapidjson::Document::AllocatorType& allocator = overrides.GetAllocator();
+                    for (auto it = scene_components.MemberBegin(); it != scene_components.MemberEnd(); ++it) {
+                        rapidjson::Value merged;
+                        auto base = prefab_components->FindMember(it->name);
+                        if (base != prefab_components->MemberEnd() && base->value.IsObject() && it->value.IsObject()) {
+                            merged.CopyFrom(base->value, allocator);
+                            merge_objects(it->value, merged, allocator);
+                        }
+                        else {
+                            merged.CopyFrom(it->value, allocator);
+                        }
+                        overrides.AddMember(rapidjson::Value(it->name, allocator), merged, allocator);
                     }
+                    Component_Parser::add_components_from_json(ECSM, eid, overrides);
+                }
+                else {
+                    Component_Parser::add_components_from_json(ECSM, eid, scene_components);
                 }
             }
 
-            // Merge components from the scene (overrides prefab components)
-            if (obj.HasMember("components") && obj["components"].IsObject()) {
-                const rapidjson::Value& scene_components = obj["components"];
-                merge_objects(scene_components, merged_components, allocator);
+            // Tag the player so systems can find it without a name lookup
+            if (entity_name == DEFAULT_PLAYER_NAME) {
+                ECSM.add_component<Player_Tag>(eid, Player_Tag());
             }
 
-            // Add components to the entity
-            Component_Parser::add_components_from_json(ECSM, eid, merged_components);
+            // The first object of a scene is its background
+            if (i == 0) {
+                ECSM.add_component<Background_Tag>(eid, Background_Tag());
+            }
+        }
+
+        // Bake the scene's static level geometry into the collision tile layer
+        if (Collision_System* collision_system = ECSM.get_system<Collision_System>()) {
+            collision_system->bake_tile_layer();
         }
 
         LM.write_log("Serialization_Manager::load_scene(): Scene loaded successfully from %s.", filename);
@@ -424,7 +460,7 @@ namespace lof {
     rapidjson::Value Serialization_Manager::serialize_graphics_component(const Graphics_Component& component, rapidjson::Document::AllocatorType& allocator) {
         rapidjson::Value comp_obj(rapidjson::kObjectType);
 
-        comp_obj.AddMember("model_name", rapidjson::Value(component.model_name.c_str(), allocator), allocator);
+        comp_obj.AddMember("model_name", rapidjson::Value(component.model_name->c_str(), allocator), allocator);
 
         rapidjson::Value color(rapidjson::kArrayType);
         color.PushBack(component.color.x, allocator);
@@ -432,7 +468,7 @@ namespace lof {
         color.PushBack(component.color.z, allocator);
         comp_obj.AddMember("color", color, allocator);
 
-        comp_obj.AddMember("texture_name", rapidjson::Value(component.texture_name.c_str(), allocator), allocator);
+        comp_obj.AddMember("texture_name", rapidjson::Value(component.texture_name->c_str(), allocator), allocator);
         comp_obj.AddMember("shd_ref", component.shd_ref, allocator);
 
         // Matrix in your scene file format
@@ -595,7 +631,7 @@ namespace lof {
         rapidjson::Value animations_array(rapidjson::kArrayType);
 
         // Iterate through the animations map
-        for (const auto& [index, name] : component.animations) {
+        for (const auto& [index, name] : component.animations.get()) {
             // Create array for each animation entry
             rapidjson::Value animation_entry(rapidjson::kArrayType);
 
@@ -642,7 +678,7 @@ namespace lof {
         rapidjson::Value comp_obj(rapidjson::kObjectType);
 
         // Add font name and text 
-        comp_obj.AddMember("font_name", rapidjson::Value(component.font_name.c_str(), allocator), allocator);
+        comp_obj.AddMember("font_name", rapidjson::Value(component.font_name->c_str(), allocator), allocator);
         comp_obj.AddMember("text", rapidjson::Value(component.text.c_str(), allocator), allocator);
 
         // Add color
@@ -690,7 +726,7 @@ namespace lof {
 
                     // Handle name
                     std::string entity_name;
-                    if (entity_id == 0) {
+                    if (ECSM.has_component<Background_Tag>(entity_id)) {
                         entity_name = "background";
                     }
                     else {
@@ -902,4 +938,9 @@ namespace lof {
         return nullptr;
     }
 
+    const Prefab_Template* Serialization_Manager::get_prefab_template(const std::string& prefab_name) const {
+        auto it = m_prefab_templates.find(prefab_name);
+        return it != m_prefab_templates.end() ? &it->second : nullptr;
+    }
+
 } // namespace lof
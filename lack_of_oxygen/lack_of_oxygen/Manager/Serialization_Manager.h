@@ -19,6 +19,7 @@
 
 // Include component headers
 #include "../Component/Component.h"
+#include "Prefab_Template.h"
 
 // Include RapidJSON headers
 #include "rapidjson/document.h"
@@ -52,6 +53,9 @@ namespace lof {
         // Cache for loaded prefabs
         std::unordered_map<std::string, rapidjson::Value> m_prefab_map;
 
+        // Prefab components parsed once at load, copied into each clone
+        std::unordered_map<std::string, Prefab_Template> m_prefab_templates;
+
         // Helper function to load the prefab file
         bool load_prefabs(const char* filepath);
 
@@ -113,6 +117,13 @@ namespace lof {
          */
         const rapidjson::Value* get_prefab(const std::string& prefab_name) const;
 
+        /**
+         * @brief Retrieve the compiled components of a prefab by its name.
+         * @param prefab_name The name of the prefab to retrieve.
+         * @return A constant pointer to the prefab's template if found; otherwise, nullptr.
+         */
+        const Prefab_Template* get_prefab_template(const std::string& prefab_name) const;
+
         /**
          * @brief Saves the current game state to a JSON file in scene format.
          * @param filepath The path where the save file should be created.
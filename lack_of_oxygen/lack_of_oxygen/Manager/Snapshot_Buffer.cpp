@@ -0,0 +1,210 @@
+/**
+ * @file Snapshot_Buffer.cpp
+ * @brief Implements the Snapshot_Buffer class for capturing and restoring component state.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Snapshot_Buffer.h"
+
+// Include other necessary headers
+#include "ECS_Manager.h"
+#include "Log_Manager.h"
+#include "Graphics_Manager.h"
+
+// Include standard headers
+#include <algorithm>
+#include <chrono>
+
+namespace lof {
+
+    namespace {
+
+        /**
+         * @brief Copy the state of every component in a pool into a record array.
+         * @param pool The pool to read.
+         * @param records The record array, cleared first so its capacity is reused.
+         * @param save Function converting a component into its saved state.
+         */
+        template<typename T, typename Record, typename Save>
+        void capture_pool(Component_Pool<T>& pool, std::vector<Record>& records, Save save) {
+            const std::vector<EntityID>& owners = pool.get_entities();
+            const std::vector<T>& components = pool.get_components();
+
+            records.clear();
+            records.reserve(components.size());
+            for (std::size_t i = 0; i < components.size(); ++i) {
+                records.push_back({ owners[i], save(components[i]) });
+            }
+        }
+
+        /**
+         * @brief Write saved states back into the components of the entities that still have them.
+         * @param pool The pool to write.
+         * @param records The saved states.
+         * @param load Function applying a saved state to a component.
+         */
+        template<typename T, typename Record, typename Load>
+        void restore_pool(Component_Pool<T>& pool, const std::vector<Record>& records, Load load) {
+            for (const Record& record : records) {
+                if (pool.has(record.entity)) {
+                    load(pool.get(record.entity), record.state);
+                }
+            }
+        }
+
+    } // namespace
+
+    Snapshot_Buffer::Snapshot_Buffer(std::size_t capacity, unsigned int interval)
+        : ring(std::max<std::size_t>(capacity, 1)), interval(std::max(interval, 1u)) {}
+
+    std::size_t Snapshot_Buffer::slot_of(std::size_t steps_back) const {
+        return (head + ring.size() - 1 - steps_back) % ring.size();
+    }
+
+    void Snapshot_Buffer::update(ECS_Manager& ecs) {
+        if (++frame_count % interval != 0) {
+            return;
+        }
+
+        // Continue history from the restored snapshot
+        if (cursor > 0) {
+            head = (head + ring.size() - cursor) % ring.size();
+            count -= cursor;
+            cursor = 0;
+        }
+
+        capture(ecs);
+    }
+
+    void Snapshot_Buffer::capture(ECS_Manager& ecs) {
+        Snapshot& snapshot = ring[head];
+        snapshot.frame = frame_count;
+
+        capture_pool(ecs.get_component_pool<Transform2D>(), snapshot.transforms, [](const Transform2D& transform) {
+            return Transform_State{ transform.position, transform.prev_position, transform.orientation, transform.scale };
+        });
+        capture_pool(ecs.get_component_pool<Velocity_Component>(), snapshot.velocities, [](const Velocity_Component& velocity) {
+            return Velocity_State{ velocity.velocity };
+        });
+        capture_pool(ecs.get_component_pool<Physics_Component>(), snapshot.physics, [](const Physics_Component& physics) {
+            return Physics_State{ physics.get_gravity(), physics.get_accumulated_force(), physics.get_acceleration(),
+                physics.get_is_grounded(), physics.get_has_jumped(), physics.get_jump_requested() };
+        });
+        capture_pool(ecs.get_component_pool<Logic_Component>(), snapshot.logic, [](const Logic_Component& logic) {
+            return Logic_State{ logic.timer, logic.origin_pos, logic.is_active, logic.reverse_direction };
+        });
+        capture_pool(ecs.get_component_pool<Animation_Component>(), snapshot.animations, [](const Animation_Component& animation) {
+            return Animation_State{ animation.curr_animation_idx };
+        });
+
+        // Animation playback lives in the Graphics_Manager, which headless worlds must not touch.
+        // Names are assigned into the existing records, so their storage is reused
+        snapshot.animation_frames.resize(ecs.is_render_enabled() ? GFXM.get_animation_storage().size() : 0);
+        if (ecs.is_render_enabled()) {
+            std::size_t index = 0;
+            for (const auto& [name, animation] : GFXM.get_animation_storage()) {
+                Animation_Frame_State& state = snapshot.animation_frames[index++];
+                state.name = name;
+                state.curr_frame_index = animation.curr_frame_index;
+                state.frame_elapsed_time = animation.frame_elapsed_time;
+            }
+        }
+
+        head = (head + 1) % ring.size();
+        count = std::min(count + 1, ring.size());
+    }
+
+    bool Snapshot_Buffer::restore(ECS_Manager& ecs, std::size_t steps_back) {
+        if (steps_back >= count) {
+            LM.write_log("Snapshot_Buffer::restore(): No snapshot %zu frames back, %zu held.", steps_back, count);
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        const Snapshot& snapshot = ring[slot_of(steps_back)];
+
+        restore_pool(ecs.get_component_pool<Transform2D>(), snapshot.transforms, [](Transform2D& transform, const Transform_State& state) {
+            transform.position = state.position;
+            transform.prev_position = state.prev_position;
+            transform.orientation = state.orientation;
+            transform.scale = state.scale;
+        });
+        restore_pool(ecs.get_component_pool<Velocity_Component>(), snapshot.velocities, [](Velocity_Component& velocity, const Velocity_State& state) {
+            velocity.velocity = state.velocity;
+        });
+        restore_pool(ecs.get_component_pool<Physics_Component>(), snapshot.physics, [](Physics_Component& physics, const Physics_State& state) {
+            physics.set_gravity(state.gravity);
+            physics.set_accumulated_force(state.accumulated_force);
+            physics.set_acceleration(state.acceleration);
+            physics.set_is_grounded(state.is_grounded);
+            physics.set_has_jumped(state.has_jumped);
+            physics.set_jump_requested(state.jump_requested);
+        });
+        restore_pool(ecs.get_component_pool<Logic_Component>(), snapshot.logic, [](Logic_Component& logic, const Logic_State& state) {
+            logic.timer = state.timer;
+            logic.origin_pos = state.origin_pos;
+            logic.is_active = state.is_active;
+            logic.reverse_direction = state.reverse_direction;
+        });
+        restore_pool(ecs.get_component_pool<Animation_Component>(), snapshot.animations, [](Animation_Component& animation, const Animation_State& state) {
+            animation.curr_animation_idx = state.curr_animation_idx;
+        });
+
+        if (ecs.is_render_enabled()) {
+            auto& animation_storage = GFXM.get_animation_storage();
+            for (const Animation_Frame_State& state : snapshot.animation_frames) {
+                auto animation = animation_storage.find(state.name);
+                if (animation != animation_storage.end()) {
+                    animation->second.curr_frame_index = state.curr_frame_index;
+                    animation->second.frame_elapsed_time = state.frame_elapsed_time;
+                }
+            }
+        }
+
+        cursor = steps_back;
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        LM.write_log("Snapshot_Buffer::restore(): Restored frame %llu in %lld microseconds.",
+            static_cast<unsigned long long>(snapshot.frame), static_cast<long long>(elapsed));
+        return true;
+    }
+
+    bool Snapshot_Buffer::step_back(ECS_Manager& ecs) {
+        return cursor + 1 < count && restore(ecs, cursor + 1);
+    }
+
+    bool Snapshot_Buffer::step_forward(ECS_Manager& ecs) {
+        return cursor > 0 && restore(ecs, cursor - 1);
+    }
+
+    void Snapshot_Buffer::set_interval(unsigned int frames) {
+        interval = std::max(frames, 1u);
+    }
+
+    void Snapshot_Buffer::set_capacity(std::size_t capacity) {
+        ring.assign(std::max<std::size_t>(capacity, 1), Snapshot());
+        head = 0;
+        count = 0;
+        cursor = 0;
+    }
+
+    std::uint64_t Snapshot_Buffer::get_frame(std::size_t steps_back) const {
+        return steps_back < count ? ring[slot_of(steps_back)].frame : 0;
+    }
+
+    std::size_t Snapshot_Buffer::size() const {
+        return count;
+    }
+
+    void Snapshot_Buffer::clear() {
+        head = 0;
+        count = 0;
+        cursor = 0;
+    }
+
+} // namespace lof
@@ -0,0 +1,194 @@
+/**
+ * @file Snapshot_Buffer.h
+ * @brief Declares the Snapshot_Buffer class for capturing and restoring component state.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_SNAPSHOT_BUFFER_H
+#define LOF_SNAPSHOT_BUFFER_H
+
+// Include standard headers
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Include other necessary headers
+#include "../Utility/Type.h"      // For EntityID
+#include "../Utility/Vector2D.h"  // For Vec2D
+
+namespace lof {
+
+    class ECS_Manager;
+
+    /**
+     * @class Snapshot_Buffer
+     * @brief Ring buffer of compact snapshots of the simulation state of every entity.
+     * @details A snapshot holds plain copies of Transform2D, Velocity_Component, the dynamic
+     *          Physics_Component fields, Logic_Component timers and the current animation of
+     *          Animation_Component, stored per component type as packed arrays. When the ECS_Manager
+     *          renders, the frame index and elapsed time of every animation in the Graphics_Manager
+     *          are saved too, since entities playing an animation share them. Snapshot storage
+     *          is reused when the ring wraps, so capturing only allocates when entity counts grow.
+     *          Restoring writes the values back into the entities that still exist. Entity creation
+     *          and destruction are not rewound, and active forces are left as they are.
+     */
+    class Snapshot_Buffer {
+    private:
+        /**
+         * @struct Record
+         * @brief The saved state of one component and the entity owning it.
+         */
+        template<typename State>
+        struct Record {
+            EntityID entity;
+            State state;
+        };
+
+        struct Transform_State {
+            Vec2D position;
+            Vec2D prev_position;
+            Vec2D orientation;
+            Vec2D scale;
+        };
+
+        struct Velocity_State {
+            Vec2D velocity;
+        };
+
+        struct Physics_State {
+            Vec2D gravity;
+            Vec2D accumulated_force;
+            Vec2D acceleration;
+            bool is_grounded;
+            bool has_jumped;
+            bool jump_requested;
+        };
+
+        struct Logic_State {
+            float timer;
+            Vec2D origin_pos;
+            bool is_active;
+            bool reverse_direction;
+        };
+
+        struct Animation_State {
+            unsigned int curr_animation_idx;
+        };
+
+        struct Animation_Frame_State {
+            std::string name;              ///< Key of the animation in the Graphics_Manager
+            unsigned int curr_frame_index;
+            float frame_elapsed_time;
+        };
+
+        /**
+         * @struct Snapshot
+         * @brief The state of every tracked component at one frame.
+         */
+        struct Snapshot {
+            std::uint64_t frame = 0;
+            std::vector<Record<Transform_State>> transforms;
+            std::vector<Record<Velocity_State>> velocities;
+            std::vector<Record<Physics_State>> physics;
+            std::vector<Record<Logic_State>> logic;
+            std::vector<Record<Animation_State>> animations;
+            std::vector<Animation_Frame_State> animation_frames;
+        };
+
+        std::vector<Snapshot> ring;     ///< Snapshot slots, allocated up front
+        std::size_t head = 0;           ///< Slot the next capture writes to
+        std::size_t count = 0;          ///< Number of valid snapshots
+        std::size_t cursor = 0;         ///< Steps back from the newest snapshot of the last restore
+        unsigned int interval;          ///< Frames between captures
+        std::uint64_t frame_count = 0;  ///< Frames passed to update()
+
+        /**
+         * @brief Get the slot of a snapshot counted back from the newest.
+         * @param steps_back 0 for the newest snapshot.
+         * @return Index into the ring.
+         */
+        std::size_t slot_of(std::size_t steps_back) const;
+
+    public:
+        /**
+         * @brief Constructor for Snapshot_Buffer.
+         * @param capacity The number of snapshots kept before the oldest is overwritten.
+         * @param interval The number of frames between captures.
+         */
+        Snapshot_Buffer(std::size_t capacity, unsigned int interval);
+
+        /**
+         * @brief Count a simulated frame and capture a snapshot every interval frames.
+         * @details After a rewind, the snapshots newer than the restored one are dropped, so
+         *          history continues from the restored state.
+         * @param ecs The ECS_Manager to capture.
+         */
+        void update(ECS_Manager& ecs);
+
+        /**
+         * @brief Capture a snapshot now, overwriting the oldest once the ring is full.
+         * @param ecs The ECS_Manager to capture.
+         */
+        void capture(ECS_Manager& ecs);
+
+        /**
+         * @brief Restore a snapshot.
+         * @param ecs The ECS_Manager to restore into.
+         * @param steps_back 0 for the newest snapshot, 1 for the one before it, and so on.
+         * @return True if the snapshot exists and was restored, false otherwise.
+         */
+        bool restore(ECS_Manager& ecs, std::size_t steps_back);
+
+        /**
+         * @brief Restore the snapshot before the last restored one.
+         * @param ecs The ECS_Manager to restore into.
+         * @return True if an older snapshot was restored, false if already at the oldest.
+         */
+        bool step_back(ECS_Manager& ecs);
+
+        /**
+         * @brief Restore the snapshot after the last restored one.
+         * @param ecs The ECS_Manager to restore into.
+         * @return True if a newer snapshot was restored, false if already at the newest.
+         */
+        bool step_forward(ECS_Manager& ecs);
+
+        /**
+         * @brief Set the number of frames between captures.
+         * @param frames The capture interval, at least 1.
+         */
+        void set_interval(unsigned int frames);
+
+        /**
+         * @brief Resize the ring, discarding every snapshot.
+         * @param capacity The number of snapshots to keep, at least 1.
+         */
+        void set_capacity(std::size_t capacity);
+
+        /**
+         * @brief Get the frame a snapshot was captured at.
+         * @param steps_back 0 for the newest snapshot.
+         * @return The frame number, or 0 if there is no such snapshot.
+         */
+        std::uint64_t get_frame(std::size_t steps_back) const;
+
+        /**
+         * @brief Get the number of snapshots held.
+         * @return The number of valid snapshots.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Discard every snapshot, keeping the allocated storage.
+         */
+        void clear();
+    };
+
+} // namespace lof
+
+#endif // LOF_SNAPSHOT_BUFFER_H
@@ -0,0 +1,65 @@
+/**
+ * @file World.cpp
+ * @brief Implements the World class, an independent ECS instance for running simulations side by side.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "World.h"
+
+// Include other managers
+#include "Log_Manager.h"
+#include "Serialization_Manager.h"
+
+// Include standard headers
+#include <mutex>
+
+namespace lof {
+
+    namespace {
+        // The Serialization_Manager keeps the document being loaded, so scenes load one at a time
+        std::mutex scene_load_mutex;
+    }
+
+    World::World(const World_Config& config)
+        : ecs(new ECS_Manager()) {
+        ecs->render_enabled = config.render;
+        ecs->audio_enabled = config.audio;
+        ecs->history_enabled = config.record_history;
+
+        // Systems look up the ECS through ECSM while they are constructed
+        ECS_Binding binding(*ecs);
+        if (ecs->start_up() != 0) {
+            LM.write_log("World::World(): Failed to start up the world's ECS_Manager.");
+        }
+    }
+
+    World::~World() {
+        ECS_Binding binding(*ecs);
+        ecs->shut_down();
+    }
+
+    bool World::is_started() const {
+        return ecs->is_started();
+    }
+
+    bool World::load_scene(const std::string& filename) {
+        std::lock_guard<std::mutex> lock(scene_load_mutex);
+        ECS_Binding binding(*ecs);
+        return SM.load_scene(filename.c_str());
+    }
+
+    void World::update(float delta_time) {
+        ECS_Binding binding(*ecs);
+        ecs->update(delta_time);
+    }
+
+    ECS_Manager& World::get_ecs() {
+        return *ecs;
+    }
+
+} // namespace lof
@@ -0,0 +1,110 @@
+/**
+ * @file World.h
+ * @brief Defines the World class, an independent ECS instance for running simulations side by side.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_WORLD_H
+#define LOF_WORLD_H
+
+// Include other necessary headers
+#include "ECS_Manager.h"
+
+// Include standard headers
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace lof {
+
+    /**
+     * @struct World_Config
+     * @brief Selects which optional parts a World is created with.
+     */
+    struct World_Config {
+        bool render = false;          ///< Add the render, GUI and animation systems, which share the Graphics_Manager
+        bool audio = false;           ///< Add the audio system
+        bool record_history = false;  ///< Record frames in the snapshot buffer for rewinding
+    };
+
+    /**
+     * @class World
+     * @brief Owns an ECS_Manager with its own entities, component pools and systems.
+     * @details Many worlds can exist at once and each can be updated on its own thread. Every call
+     *          into a world binds its ECS_Manager to the calling thread, so ECSM inside its systems,
+     *          and inside code passed to run(), refers to that world. A world must only be used by
+     *          one thread at a time. Worlds created without rendering or audio never touch the
+     *          Graphics_Manager, the Assets_Manager's GPU resources or the audio device, so they do
+     *          not share mutable state with each other apart from the thread-safe Log_Manager and
+     *          Job_Manager.
+     */
+    class World {
+    private:
+        std::unique_ptr<ECS_Manager> ecs; ///< The world's entities, pools and systems
+
+    public:
+        /**
+         * @brief Create and start up a world.
+         * @param config The optional parts to create the world with.
+         */
+        explicit World(const World_Config& config = World_Config());
+
+        /**
+         * @brief Shut down the world, destroying its entities and systems.
+         */
+        ~World();
+
+        // Delete copy constructor and assignment operator
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        /**
+         * @brief Check if the world started up successfully.
+         * @return True if the world can be used, false otherwise.
+         */
+        bool is_started() const;
+
+        /**
+         * @brief Replace the world's entities with those of a scene file.
+         * @details Scene loading goes through the shared Serialization_Manager, so only one world
+         *          loads a scene at a time. Prefabs must have been loaded by the Serialization_Manager.
+         * @param filename The path of the scene file.
+         * @return True if the scene was loaded, false otherwise.
+         */
+        bool load_scene(const std::string& filename);
+
+        /**
+         * @brief Update every system of the world once.
+         * @param delta_time The time elapsed since the last update.
+         */
+        void update(float delta_time);
+
+        /**
+         * @brief Run code with the world bound to the calling thread.
+         * @param fn Callable invoked as fn(ecs) with the world's ECS_Manager.
+         * @return The value returned by fn.
+         */
+        template<typename Func>
+        decltype(auto) run(Func&& fn);
+
+        /**
+         * @brief Get the world's ECS_Manager.
+         * @details ECSM does not refer to this instance outside of the world's own calls.
+         * @return Reference to the world's ECS_Manager.
+         */
+        ECS_Manager& get_ecs();
+    };
+
+    template<typename Func>
+    decltype(auto) World::run(Func&& fn) {
+        ECS_Binding binding(*ecs);
+        return std::forward<Func>(fn)(*ecs);
+    }
+
+} // namespace lof
+
+#endif // LOF_WORLD_H
@@ -0,0 +1,35 @@
+/**
+ * @file AABB.cpp
+ * @brief Implements the AABB struct, the axis-aligned box the collision code works with.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "AABB.h"
+
+// Include other necessary headers
+#include "../Component/Component.h"
+
+namespace lof {
+
+    AABB::AABB(const Vec2D& min, const Vec2D& max)
+        : min(min), max(max) {}
+
+    AABB AABB::from_transform(const Transform2D& transform, const Collision_Component& collision) {
+        Vec2D min;
+        Vec2D max;
+
+        min.x = transform.prev_position.x - (collision.width / 2.0f);
+        min.y = transform.prev_position.y - (collision.height / 2.0f);
+
+        max.x = transform.prev_position.x + (collision.width / 2.0f);
+        max.y = transform.prev_position.y + (collision.height / 2.0f);
+
+        return AABB(min, max);
+    }
+
+} // namespace lof
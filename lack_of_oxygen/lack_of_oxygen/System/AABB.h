@@ -0,0 +1,48 @@
+/**
+ * @file AABB.h
+ * @brief Declares the AABB struct, the axis-aligned box the collision code works with.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_AABB_H
+#define LOF_AABB_H
+
+// Include other necessary headers
+#include "../Utility/Vector2D.h"
+
+namespace lof {
+
+    class Transform2D;
+    class Collision_Component;
+
+    /**
+     * @struct AABB
+     * @brief Represents axis-aligned bounding boxes for collision detection.
+     */
+    struct AABB {
+        Vec2D min; ///< Minimum point of the bounding box
+        Vec2D max; ///< Maximum point of the bounding box
+
+        /**
+         * @brief Constructor to initialize minimum and maximum points of AABB.
+         * @param min Minimum corner of the bounding box.
+         * @param max Maximum corner of the bounding box.
+         */
+        AABB(const Vec2D& min, const Vec2D& max);
+
+        /**
+         * @brief Create AABB from Transform2D and Collision_Component.
+         * @param transform Transform component data including position, rotation, scale.
+         * @param collision Collision component data including width and height.
+         * @return AABB instance.
+         */
+        static AABB from_transform(const Transform2D& transform, const Collision_Component& collision);
+    };
+
+} // namespace lof
+
+#endif // LOF_AABB_H
@@ -0,0 +1,508 @@
+/**
+ * @file AABB_Tree.cpp
+ * @brief Implements the AABB_Tree class, a bounding volume hierarchy of entity boxes.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "AABB_Tree.h"
+
+// Include other necessary headers
+#include "AABB.h"
+
+// Include standard headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace lof {
+
+    namespace {
+        /**
+         * @brief Check if two boxes overlap, touching edges included.
+         */
+        bool bounds_overlap(const Vec2D& min1, const Vec2D& max1, const Vec2D& min2, const Vec2D& max2) {
+            return !(max1.x < min2.x || min1.x > max2.x || max1.y < min2.y || min1.y > max2.y);
+        }
+
+        /**
+         * @brief Get the perimeter of a box, the cost used to choose where leaves go.
+         */
+        float perimeter(const Vec2D& min, const Vec2D& max) {
+            return 2.0f * ((max.x - min.x) + (max.y - min.y));
+        }
+
+        /**
+         * @brief Get the perimeter of the union of two boxes.
+         */
+        float combined_perimeter(const Vec2D& min1, const Vec2D& max1, const Vec2D& min2, const Vec2D& max2) {
+            return perimeter(Vec2D(std::min(min1.x, min2.x), std::min(min1.y, min2.y)),
+                Vec2D(std::max(max1.x, max2.x), std::max(max1.y, max2.y)));
+        }
+    }
+
+    AABB_Tree::AABB_Tree(float margin)
+        : margin(margin > 0.0f ? margin : 0.0f) {}
+
+    std::int32_t AABB_Tree::allocate_node() {
+        if (free_list == NULL_NODE) {
+            nodes.emplace_back();
+            return static_cast<std::int32_t>(nodes.size() - 1);
+        }
+
+        std::int32_t node = free_list;
+        free_list = nodes[node].parent;
+        nodes[node] = Node();
+        return node;
+    }
+
+    void AABB_Tree::free_node(std::int32_t node) {
+        nodes[node].parent = free_list;
+        nodes[node].height = -1;
+        nodes[node].child1 = NULL_NODE;
+        nodes[node].child2 = NULL_NODE;
+        free_list = node;
+    }
+
+    void AABB_Tree::refit(std::int32_t node) {
+        const Node& child1 = nodes[nodes[node].child1];
+        const Node& child2 = nodes[nodes[node].child2];
+        nodes[node].min = Vec2D(std::min(child1.min.x, child2.min.x), std::min(child1.min.y, child2.min.y));
+        nodes[node].max = Vec2D(std::max(child1.max.x, child2.max.x), std::max(child1.max.y, child2.max.y));
+        nodes[node].height = 1 + std::max(child1.height, child2.height);
+    }
+
+    void AABB_Tree::insert_leaf(std::int32_t leaf) {
+        if (root == NULL_NODE) {
+            root = leaf;
+            nodes[root].parent = NULL_NODE;
+            return;
+        }
+
+        // Walk down to the sibling that grows the tree's total perimeter the least
+        const Vec2D leaf_min = nodes[leaf].min;
+        const Vec2D leaf_max = nodes[leaf].max;
+        std::int32_t index = root;
+        while (!nodes[index].is_leaf()) {
+            const Node& node = nodes[index];
+            float area = perimeter(node.min, node.max);
+            float combined = combined_perimeter(node.min, node.max, leaf_min, leaf_max);
+
+            // Cost of pairing the leaf with this node, and of pushing it further down
+            float cost = 2.0f * combined;
+            float inheritance = 2.0f * (combined - area);
+
+            auto descend_cost = [&](std::int32_t child_index) {
+                const Node& child = nodes[child_index];
+                float cost_child = combined_perimeter(child.min, child.max, leaf_min, leaf_max);
+                if (!child.is_leaf()) {
+                    cost_child -= perimeter(child.min, child.max);
+                }
+                return cost_child + inheritance;
+            };
+            float cost1 = descend_cost(node.child1);
+            float cost2 = descend_cost(node.child2);
+
+            if (cost < cost1 && cost < cost2) {
+                break;
+            }
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+        std::int32_t sibling = index;
+
+        // Put a new branch above the sibling holding it and the leaf
+        std::int32_t old_parent = nodes[sibling].parent;
+        std::int32_t new_parent = allocate_node();
+        nodes[new_parent].parent = old_parent;
+        nodes[new_parent].child1 = sibling;
+        nodes[new_parent].child2 = leaf;
+        nodes[sibling].parent = new_parent;
+        nodes[leaf].parent = new_parent;
+        refit(new_parent);
+
+        if (old_parent != NULL_NODE) {
+            if (nodes[old_parent].child1 == sibling) {
+                nodes[old_parent].child1 = new_parent;
+            }
+            else {
+                nodes[old_parent].child2 = new_parent;
+            }
+        }
+        else {
+            root = new_parent;
+        }
+
+        // Rebalance and refit the ancestors
+        index = nodes[leaf].parent;
+        while (index != NULL_NODE) {
+            index = balance(index);
+            refit(index);
+            index = nodes[index].parent;
+        }
+    }
+
+    void AABB_Tree::remove_leaf(std::int32_t leaf) {
+        if (leaf == root) {
+            root = NULL_NODE;
+            return;
+        }
+
+        // Replace the leaf's parent with the leaf's sibling
+        std::int32_t parent = nodes[leaf].parent;
+        std::int32_t grand_parent = nodes[parent].parent;
+        std::int32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+        if (grand_parent != NULL_NODE) {
+            if (nodes[grand_parent].child1 == parent) {
+                nodes[grand_parent].child1 = sibling;
+            }
+            else {
+                nodes[grand_parent].child2 = sibling;
+            }
+            nodes[sibling].parent = grand_parent;
+            free_node(parent);
+
+            // Rebalance and refit the ancestors
+            std::int32_t index = grand_parent;
+            while (index != NULL_NODE) {
+                index = balance(index);
+                refit(index);
+                index = nodes[index].parent;
+            }
+        }
+        else {
+            root = sibling;
+            nodes[sibling].parent = NULL_NODE;
+            free_node(parent);
+        }
+    }
+
+    std::int32_t AABB_Tree::balance(std::int32_t a) {
+        if (nodes[a].is_leaf() || nodes[a].height < 2) {
+            return a;
+        }
+
+        std::int32_t b = nodes[a].child1;
+        std::int32_t c = nodes[a].child2;
+        std::int32_t difference = nodes[c].height - nodes[b].height;
+
+        // Rotate the taller child up into the node's place
+        auto rotate_up = [this, a](std::int32_t up, std::int32_t other, bool up_is_child2) {
+            std::int32_t f = nodes[up].child1;
+            std::int32_t g = nodes[up].child2;
+
+            // Swap the node and the child rising above it
+            nodes[up].child1 = a;
+            nodes[up].parent = nodes[a].parent;
+            nodes[a].parent = up;
+
+            std::int32_t grand_parent = nodes[up].parent;
+            if (grand_parent != NULL_NODE) {
+                if (nodes[grand_parent].child1 == a) {
+                    nodes[grand_parent].child1 = up;
+                }
+                else {
+                    nodes[grand_parent].child2 = up;
+                }
+            }
+            else {
+                root = up;
+            }
+
+            // The taller grandchild stays under the risen child, the shorter moves under the node
+            std::int32_t keep = nodes[f].height > nodes[g].height ? f : g;
+            std::int32_t give = keep == f ? g : f;
+            nodes[up].child2 = keep;
+            if (up_is_child2) {
+                nodes[a].child1 = other;
+                nodes[a].child2 = give;
+            }
+            else {
+                nodes[a].child1 = give;
+                nodes[a].child2 = other;
+            }
+            nodes[give].parent = a;
+
+            refit(a);
+            refit(up);
+            return up;
+        };
+
+        if (difference > 1) {
+            return rotate_up(c, b, true);
+        }
+        if (difference < -1) {
+            return rotate_up(b, c, false);
+        }
+        return a;
+    }
+
+    std::int32_t AABB_Tree::create_proxy(EntityID entity, const AABB& box) {
+        std::int32_t proxy = allocate_node();
+        nodes[proxy].min = Vec2D(box.min.x - margin, box.min.y - margin);
+        nodes[proxy].max = Vec2D(box.max.x + margin, box.max.y + margin);
+        nodes[proxy].entity = entity;
+        nodes[proxy].height = 0;
+        insert_leaf(proxy);
+        ++leaf_count;
+        return proxy;
+    }
+
+    void AABB_Tree::destroy_proxy(std::int32_t proxy) {
+        assert(proxy >= 0 && proxy < static_cast<std::int32_t>(nodes.size()) && nodes[proxy].is_leaf() && "Invalid proxy.");
+        remove_leaf(proxy);
+        free_node(proxy);
+        --leaf_count;
+    }
+
+    bool AABB_Tree::move_proxy(std::int32_t proxy, const AABB& box) {
+        assert(proxy >= 0 && proxy < static_cast<std::int32_t>(nodes.size()) && nodes[proxy].is_leaf() && "Invalid proxy.");
+        Node& leaf = nodes[proxy];
+        if (box.min.x >= leaf.min.x && box.min.y >= leaf.min.y && box.max.x <= leaf.max.x && box.max.y <= leaf.max.y) {
+            return false;
+        }
+
+        remove_leaf(proxy);
+        leaf.min = Vec2D(box.min.x - margin, box.min.y - margin);
+        leaf.max = Vec2D(box.max.x + margin, box.max.y + margin);
+        insert_leaf(proxy);
+        return true;
+    }
+
+    void AABB_Tree::build(const std::vector<EntityID>& entities, const std::vector<AABB>& boxes) {
+        clear();
+        if (boxes.empty()) {
+            return;
+        }
+
+        std::vector<std::int32_t> leaves;
+        leaves.reserve(boxes.size());
+        nodes.reserve(boxes.size() * 2);
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            std::int32_t leaf = allocate_node();
+            nodes[leaf].min = Vec2D(boxes[i].min.x - margin, boxes[i].min.y - margin);
+            nodes[leaf].max = Vec2D(boxes[i].max.x + margin, boxes[i].max.y + margin);
+            nodes[leaf].entity = entities[i];
+            nodes[leaf].height = 0;
+            leaves.push_back(leaf);
+        }
+        leaf_count = leaves.size();
+
+        root = build_range(leaves, 0, leaves.size());
+        nodes[root].parent = NULL_NODE;
+    }
+
+    std::int32_t AABB_Tree::build_range(std::vector<std::int32_t>& leaves, std::size_t first, std::size_t last) {
+        if (last - first == 1) {
+            return leaves[first];
+        }
+
+        // Split at the median centre along the axis the centres spread over the most
+        float min_x = nodes[leaves[first]].min.x + nodes[leaves[first]].max.x;
+        float max_x = min_x;
+        float min_y = nodes[leaves[first]].min.y + nodes[leaves[first]].max.y;
+        float max_y = min_y;
+        for (std::size_t i = first + 1; i < last; ++i) {
+            float centre_x = nodes[leaves[i]].min.x + nodes[leaves[i]].max.x;
+            float centre_y = nodes[leaves[i]].min.y + nodes[leaves[i]].max.y;
+            min_x = std::min(min_x, centre_x);
+            max_x = std::max(max_x, centre_x);
+            min_y = std::min(min_y, centre_y);
+            max_y = std::max(max_y, centre_y);
+        }
+        bool split_x = (max_x - min_x) >= (max_y - min_y);
+
+        std::size_t middle = first + (last - first) / 2;
+        std::nth_element(leaves.begin() + first, leaves.begin() + middle, leaves.begin() + last,
+            [this, split_x](std::int32_t a, std::int32_t b) {
+                return split_x ? nodes[a].min.x + nodes[a].max.x < nodes[b].min.x + nodes[b].max.x
+                    : nodes[a].min.y + nodes[a].max.y < nodes[b].min.y + nodes[b].max.y;
+            });
+
+        std::int32_t child1 = build_range(leaves, first, middle);
+        std::int32_t child2 = build_range(leaves, middle, last);
+        std::int32_t branch = allocate_node();
+        nodes[branch].child1 = child1;
+        nodes[branch].child2 = child2;
+        nodes[child1].parent = branch;
+        nodes[child2].parent = branch;
+        refit(branch);
+        return branch;
+    }
+
+    void AABB_Tree::clear() {
+        nodes.clear();
+        root = NULL_NODE;
+        free_list = NULL_NODE;
+        leaf_count = 0;
+    }
+
+    void AABB_Tree::query(const AABB& box, std::vector<EntityID>& found) const {
+        if (root == NULL_NODE) {
+            return;
+        }
+
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.back()];
+            stack.pop_back();
+            if (!bounds_overlap(node.min, node.max, box.min, box.max)) {
+                continue;
+            }
+            if (node.is_leaf()) {
+                found.push_back(node.entity);
+            }
+            else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    void AABB_Tree::query_pairs(std::vector<Entity_Pair>& pairs) const {
+        if (root == NULL_NODE) {
+            return;
+        }
+
+        // Query the tree with each leaf, keeping each pair once by node index
+        for (std::int32_t leaf = 0; leaf < static_cast<std::int32_t>(nodes.size()); ++leaf) {
+            const Node& leaf_node = nodes[leaf];
+            if (leaf_node.height != 0) {
+                continue;
+            }
+
+            stack.clear();
+            stack.push_back(root);
+            while (!stack.empty()) {
+                std::int32_t index = stack.back();
+                stack.pop_back();
+                const Node& node = nodes[index];
+                if (!bounds_overlap(node.min, node.max, leaf_node.min, leaf_node.max)) {
+                    continue;
+                }
+                if (node.is_leaf()) {
+                    if (index > leaf) {
+                        pairs.emplace_back(std::min(leaf_node.entity, node.entity), std::max(leaf_node.entity, node.entity));
+                    }
+                }
+                else {
+                    stack.push_back(node.child1);
+                    stack.push_back(node.child2);
+                }
+            }
+        }
+    }
+
+    void AABB_Tree::query_pairs(const AABB_Tree& other, std::vector<Entity_Pair>& pairs) const {
+        if (root == NULL_NODE || other.root == NULL_NODE) {
+            return;
+        }
+
+        // Walk both trees together, only descending into pairs of overlapping nodes
+        std::vector<std::pair<std::int32_t, std::int32_t>>& pending = pair_stack;
+        pending.clear();
+        pending.emplace_back(root, other.root);
+        while (!pending.empty()) {
+            auto [mine, theirs] = pending.back();
+            pending.pop_back();
+            const Node& a = nodes[mine];
+            const Node& b = other.nodes[theirs];
+            if (!bounds_overlap(a.min, a.max, b.min, b.max)) {
+                continue;
+            }
+
+            if (a.is_leaf() && b.is_leaf()) {
+                pairs.emplace_back(a.entity, b.entity);
+            }
+            else if (b.is_leaf() || (!a.is_leaf() && a.height >= b.height)) {
+                pending.emplace_back(a.child1, theirs);
+                pending.emplace_back(a.child2, theirs);
+            }
+            else {
+                pending.emplace_back(mine, b.child1);
+                pending.emplace_back(mine, b.child2);
+            }
+        }
+    }
+
+    void AABB_Tree::ray_cast(const Vec2D& start, const Vec2D& end, std::vector<Ray_Hit>& hits) const {
+        hits.clear();
+        if (root == NULL_NODE) {
+            return;
+        }
+
+        Vec2D direction(end.x - start.x, end.y - start.y);
+
+        // Slab test of the segment against a box, giving where the segment enters it
+        auto segment_enters = [&start, &direction](const Node& node, float& fraction) {
+            float enter = 0.0f;
+            float exit = 1.0f;
+            const float starts[2] = { start.x, start.y };
+            const float directions[2] = { direction.x, direction.y };
+            const float mins[2] = { node.min.x, node.min.y };
+            const float maxs[2] = { node.max.x, node.max.y };
+            for (int axis = 0; axis < 2; ++axis) {
+                if (directions[axis] == 0.0f) {
+                    if (starts[axis] < mins[axis] || starts[axis] > maxs[axis]) {
+                        return false;
+                    }
+                    continue;
+                }
+                float inverse = 1.0f / directions[axis];
+                float near_t = (mins[axis] - starts[axis]) * inverse;
+                float far_t = (maxs[axis] - starts[axis]) * inverse;
+                if (near_t > far_t) {
+                    std::swap(near_t, far_t);
+                }
+                enter = std::max(enter, near_t);
+                exit = std::min(exit, far_t);
+                if (enter > exit) {
+                    return false;
+                }
+            }
+            fraction = enter;
+            return true;
+        };
+
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.back()];
+            stack.pop_back();
+            float fraction = 0.0f;
+            if (!segment_enters(node, fraction)) {
+                continue;
+            }
+            if (node.is_leaf()) {
+                hits.push_back({ node.entity, fraction });
+            }
+            else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+
+        std::sort(hits.begin(), hits.end(), [](const Ray_Hit& a, const Ray_Hit& b) {
+            return a.fraction < b.fraction;
+        });
+    }
+
+    EntityID AABB_Tree::get_entity(std::int32_t proxy) const {
+        assert(proxy >= 0 && proxy < static_cast<std::int32_t>(nodes.size()) && nodes[proxy].is_leaf() && "Invalid proxy.");
+        return nodes[proxy].entity;
+    }
+
+    std::size_t AABB_Tree::size() const {
+        return leaf_count;
+    }
+
+    std::int32_t AABB_Tree::get_height() const {
+        return root == NULL_NODE ? 0 : nodes[root].height;
+    }
+
+} // namespace lof
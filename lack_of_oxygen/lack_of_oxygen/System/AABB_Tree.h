@@ -0,0 +1,182 @@
+/**
+ * @file AABB_Tree.h
+ * @brief Declares the AABB_Tree class, a bounding volume hierarchy of entity boxes.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_AABB_TREE_H
+#define LOF_AABB_TREE_H
+
+// Include standard headers
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Include other necessary headers
+#include "../Utility/Vector2D.h"
+#include "../Utility/Type.h" // For EntityID
+
+namespace lof {
+
+    struct AABB;
+
+    /**
+     * @typedef Entity_Pair
+     * @brief Two entities whose boxes overlap, the smaller ID first.
+     */
+    using Entity_Pair = std::pair<EntityID, EntityID>;
+
+    /**
+     * @struct Ray_Hit
+     * @brief An entity whose box a ray passes through.
+     */
+    struct Ray_Hit {
+        EntityID entity;    ///< The entity owning the box
+        float fraction;     ///< Where the ray enters the box, from 0 at its start to 1 at its end
+    };
+
+    /**
+     * @class AABB_Tree
+     * @brief Bounding volume hierarchy of entity boxes, kept balanced by tree rotations.
+     * @details Each leaf holds one entity's box enlarged by the tree's margin, and each branch the
+     *          union of its children. Moving a proxy only reinserts its leaf when the new box leaves
+     *          the enlarged one, so bodies that move a little do not touch the tree. build() replaces
+     *          the whole tree with a top-down median split, for sets of boxes that never move.
+     *          Queries share scratch space, so one tree must not be queried from several threads
+     *          at once.
+     */
+    class AABB_Tree {
+    public:
+        static constexpr std::int32_t NULL_NODE = -1; ///< Index of no node
+
+    private:
+        /**
+         * @struct Node
+         * @brief A leaf holding an entity's box, or a branch holding the union of its two children.
+         */
+        struct Node {
+            Vec2D min;                           ///< Minimum corner of the enlarged box
+            Vec2D max;                           ///< Maximum corner of the enlarged box
+            EntityID entity = INVALID_ENTITY_ID; ///< Entity of a leaf
+            std::int32_t parent = NULL_NODE;     ///< Parent node, or the next free node while unused
+            std::int32_t child1 = NULL_NODE;     ///< First child, NULL_NODE for a leaf
+            std::int32_t child2 = NULL_NODE;     ///< Second child, NULL_NODE for a leaf
+            std::int32_t height = -1;            ///< 0 for a leaf, -1 while unused
+
+            bool is_leaf() const { return child1 == NULL_NODE; }
+        };
+
+        std::vector<Node> nodes;                        ///< Node storage, unused nodes are on the free list
+        std::int32_t root = NULL_NODE;                  ///< Root node
+        std::int32_t free_list = NULL_NODE;             ///< First unused node
+        std::size_t leaf_count = 0;                     ///< Number of proxies
+        float margin;                                   ///< Distance leaf boxes are enlarged by on each side
+        mutable std::vector<std::int32_t> stack;        ///< Scratch stack for traversals
+        mutable std::vector<std::pair<std::int32_t, std::int32_t>> pair_stack; ///< Scratch stack for walking two trees
+
+        std::int32_t allocate_node();
+        void free_node(std::int32_t node);
+        void insert_leaf(std::int32_t leaf);
+        void remove_leaf(std::int32_t leaf);
+        std::int32_t balance(std::int32_t node);
+        void refit(std::int32_t node);
+        std::int32_t build_range(std::vector<std::int32_t>& leaves, std::size_t first, std::size_t last);
+
+    public:
+        /**
+         * @brief Constructor for AABB_Tree.
+         * @param margin Distance leaf boxes are enlarged by on each side, 0 for boxes that never move.
+         */
+        explicit AABB_Tree(float margin = 0.0f);
+
+        /**
+         * @brief Add an entity's box to the tree.
+         * @param entity The entity owning the box.
+         * @param box The entity's box.
+         * @return The proxy of the box, used to move or remove it.
+         */
+        std::int32_t create_proxy(EntityID entity, const AABB& box);
+
+        /**
+         * @brief Remove a box from the tree.
+         * @param proxy The proxy returned by create_proxy().
+         */
+        void destroy_proxy(std::int32_t proxy);
+
+        /**
+         * @brief Update the box of a proxy.
+         * @param proxy The proxy returned by create_proxy().
+         * @param box The entity's new box.
+         * @return True if the leaf was reinserted, false if the box still fits the enlarged one.
+         */
+        bool move_proxy(std::int32_t proxy, const AABB& box);
+
+        /**
+         * @brief Replace the tree with one built from a set of boxes.
+         * @details Proxies from before are no longer valid.
+         * @param entities The entity owning each box.
+         * @param boxes The boxes to build from.
+         */
+        void build(const std::vector<EntityID>& entities, const std::vector<AABB>& boxes);
+
+        /**
+         * @brief Remove every box.
+         */
+        void clear();
+
+        /**
+         * @brief Find the entities whose enlarged boxes overlap a box, touching edges included.
+         * @param box The box to test.
+         * @param found Output for the entities, appended to.
+         */
+        void query(const AABB& box, std::vector<EntityID>& found) const;
+
+        /**
+         * @brief Find the pairs of entities in this tree whose enlarged boxes overlap.
+         * @param pairs Output for the pairs, appended to.
+         */
+        void query_pairs(std::vector<Entity_Pair>& pairs) const;
+
+        /**
+         * @brief Find the pairs of an entity in this tree and one in another whose enlarged boxes overlap.
+         * @param other The other tree.
+         * @param pairs Output for the pairs, this tree's entity first, appended to.
+         */
+        void query_pairs(const AABB_Tree& other, std::vector<Entity_Pair>& pairs) const;
+
+        /**
+         * @brief Find the entities whose enlarged boxes a line segment passes through.
+         * @param start Start of the segment.
+         * @param end End of the segment.
+         * @param hits Output for the hits, replacing its contents, nearest first.
+         */
+        void ray_cast(const Vec2D& start, const Vec2D& end, std::vector<Ray_Hit>& hits) const;
+
+        /**
+         * @brief Get the entity of a proxy.
+         * @param proxy The proxy returned by create_proxy().
+         * @return The entity owning the proxy's box.
+         */
+        EntityID get_entity(std::int32_t proxy) const;
+
+        /**
+         * @brief Get the number of boxes in the tree.
+         * @return The number of proxies.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Get the height of the tree.
+         * @return The number of branches from the root to the deepest leaf, 0 for an empty tree.
+         */
+        std::int32_t get_height() const;
+    };
+
+} // namespace lof
+
+#endif // LOF_AABB_TREE_H
@@ -19,6 +19,11 @@ namespace lof {
     Animation_System::Animation_System(){ 
         // Set the required components for this system
         signature.set(ECSM.get_component_id<Animation_Component>());
+
+        // Set the components accessed during update
+        write_signature.set(ECSM.get_component_id<Animation_Component>());
+        read_signature.set(ECSM.get_component_id<Player_Tag>());
+        write_resources.set(RESOURCE_ANIMATION_STORAGE);
     }
 
     std::string Animation_System::get_type() const { 
@@ -28,6 +33,9 @@ namespace lof {
     // Updates the animation of the entity according to the current frame and time delay.
     void Animation_System::update(float delta_time) { 
 
+        // Find the player once for the whole update
+        EntityID player_id = ECSM.get_singleton<Player_Tag>();
+
         // Loop over the entities that match the system's signature
         for (EntityID entity_id : get_entities()) {  
 
@@ -35,8 +43,6 @@ namespace lof {
             auto& animation_comp = ECSM.get_component<Animation_Component>(entity_id);  
             auto& animations_storage = GFXM.get_animation_storage();   
 
-            EntityID player_id = ECSM.find_entity_by_name(DEFAULT_PLAYER_NAME);
-
             // Determine which frame of which animation to play
             // Set logic for player animation here first (This should be done before coming into animation system)
             if (entity_id == player_id) { 
@@ -47,31 +53,31 @@ namespace lof {
                 // (When changing animation index, reset previous animation curr_frame_idx and frame_time_elapsed to 0)
                 if (player_direction == MOVE_LEFT) { // Set running_left animation if not playing currently
                     if (animation_comp.curr_animation_idx != 2) {
-                        animations_storage[animation_comp.animations[std::to_string(animation_comp.curr_animation_idx)]].curr_frame_index = 0; // Reset previous animation curr_frame_idx
-                        animations_storage[animation_comp.animations[std::to_string(animation_comp.curr_animation_idx)]].frame_elapsed_time = 0.0f; // Reset previous animation frame_time_elapsed
+                        animations_storage[animation_comp.get_animation_name(animation_comp.curr_animation_idx)].curr_frame_index = 0; // Reset previous animation curr_frame_idx
+                        animations_storage[animation_comp.get_animation_name(animation_comp.curr_animation_idx)].frame_elapsed_time = 0.0f; // Reset previous animation frame_time_elapsed
                         animation_comp.curr_animation_idx = 2;
                     }
                 } else if (player_direction == MOVE_RIGHT) { // set running_right animation if not playing currently
                     if (animation_comp.curr_animation_idx != 3) {
-                        animations_storage[animation_comp.animations[std::to_string(animation_comp.curr_animation_idx)]].curr_frame_index = 0; // Reset previous animation curr_frame_idx
-                        animations_storage[animation_comp.animations[std::to_string(animation_comp.curr_animation_idx)]].frame_elapsed_time = 0.0f; // Reset previous animation frame_time_elapsed 
+                        animations_storage[animation_comp.get_animation_name(animation_comp.curr_animation_idx)].curr_frame_index = 0; // Reset previous animation curr_frame_idx
+                        animations_storage[animation_comp.get_animation_name(animation_comp.curr_animation_idx)].frame_elapsed_time = 0.0f; // Reset previous animation frame_time_elapsed 
                         animation_comp.curr_animation_idx = 3;
                     }
                 } else { // Idling (No animation)
                     // Check last direction based on last animation
                     if (animation_comp.curr_animation_idx == 2) { // Was running left
-                        animations_storage[animation_comp.animations["2"]].curr_frame_index = 0; // Reset running_left animation curr_frame_idx  
-                        animations_storage[animation_comp.animations["2"]].frame_elapsed_time = 0.0f; // Reset running_left animation frame_time_elapsed
+                        animations_storage[animation_comp.get_animation_name(2)].curr_frame_index = 0; // Reset running_left animation curr_frame_idx  
+                        animations_storage[animation_comp.get_animation_name(2)].frame_elapsed_time = 0.0f; // Reset running_left animation frame_time_elapsed
                         animation_comp.curr_animation_idx = 0;    // Set idle left
                     } else if (animation_comp.curr_animation_idx == 3) { // Was running right
-                        animations_storage[animation_comp.animations["3"]].curr_frame_index = 0; // Reset running_right animation curr_frame_idx 
-                        animations_storage[animation_comp.animations["3"]].frame_elapsed_time = 0.0f; // Reset running_right animation frame_time_elapsed
+                        animations_storage[animation_comp.get_animation_name(3)].curr_frame_index = 0; // Reset running_right animation curr_frame_idx 
+                        animations_storage[animation_comp.get_animation_name(3)].frame_elapsed_time = 0.0f; // Reset running_right animation frame_time_elapsed
                         animation_comp.curr_animation_idx = 1;    // Set idle right
                     }
                 }
 
                 // Retrieve the time delay of the current frame in the current animation
-                std::string const& curr_animation_name = animation_comp.animations[std::to_string(animation_comp.curr_animation_idx)]; 
+                std::string const& curr_animation_name = animation_comp.get_animation_name(animation_comp.curr_animation_idx); 
                 unsigned int& curr_frame_idx = animations_storage[curr_animation_name].curr_frame_index; 
                 float delay = animations_storage[curr_animation_name].frames[curr_frame_idx].time_delay;
 
@@ -91,7 +97,7 @@ namespace lof {
             } else { // Other objects that animates based on time only (i.e vent, etc)
 
                 // Retrieve the time delay of the current frame in the current animation
-                std::string const& curr_animation_name = animation_comp.animations[std::to_string(animation_comp.curr_animation_idx)]; 
+                std::string const& curr_animation_name = animation_comp.get_animation_name(animation_comp.curr_animation_idx); 
                 unsigned int& curr_frame_idx = animations_storage[curr_animation_name].curr_frame_index; 
                 float delay = animations_storage[curr_animation_name].frames[curr_frame_idx].time_delay; 
 
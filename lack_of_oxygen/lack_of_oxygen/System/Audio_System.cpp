@@ -25,6 +25,8 @@ namespace lof {
 	//initialize the core system
 	Audio_System::Audio_System() : core_system(nullptr), mastergroup(nullptr), bgmgroup(nullptr), sfxgroup(nullptr) {
 		signature.set(ECSM.get_component_id<Audio_Component>());	//initialize the signature set for the audio component
+		write_signature.set(ECSM.get_component_id<Audio_Component>());	//audio states are updated during update
+		set_update_rate(DEFAULT_AUDIO_UPDATE_RATE);	//polling audio states does not need the full frame rate
 		//initializegroups();
 		if (initialize()) {
 			LM.write_log("successfully initialize audio system.");
@@ -156,6 +158,10 @@ namespace lof {
 		return "Audio_System";
 	}
 
+	bool Audio_System::runs_in_editor() const {
+		return false;
+	}
+
 	void Audio_System::load_sound(const std::string& file_path) {
 		if (sound_map.find(file_path) != sound_map.end()) {
 			//sound is already loaded in the map.
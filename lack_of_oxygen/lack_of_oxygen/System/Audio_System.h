@@ -233,6 +233,12 @@ namespace lof {
 		*/
 		std::string get_type() const override;
 
+		/**
+		* @brief Audio is paused while the level editor is active
+		* @return false
+		*/
+		bool runs_in_editor() const override;
+
 	private:
 
 		FMOD::System* core_system;	///<Core audio system
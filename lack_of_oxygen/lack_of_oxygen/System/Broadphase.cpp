@@ -0,0 +1,415 @@
+/**
+ * @file Broadphase.cpp
+ * @brief Implements the broadphases that find candidate collision pairs for the Collision_System.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Broadphase.h"
+
+// Include other necessary headers
+#include "AABB.h"
+
+// Include standard headers
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace lof {
+
+    namespace {
+        /**
+         * @brief Check if two boxes overlap, touching edges included.
+         * @details Matches the rejection test at the start of the narrowphase.
+         */
+        bool boxes_overlap(const AABB& a, const AABB& b) {
+            return !(a.max.x < b.min.x || a.min.x > b.max.x ||
+                a.max.y < b.min.y || a.min.y > b.max.y);
+        }
+
+        /**
+         * @brief Get the cell coordinate holding a world coordinate, clamped to the 32-bit range.
+         */
+        std::int64_t cell_coordinate(float value, float cell_size) {
+            constexpr double MIN_CELL = static_cast<double>(std::numeric_limits<std::int32_t>::min());
+            constexpr double MAX_CELL = static_cast<double>(std::numeric_limits<std::int32_t>::max());
+            double cell = std::floor(static_cast<double>(value) / cell_size);
+            return static_cast<std::int64_t>(std::clamp(cell, MIN_CELL, MAX_CELL));
+        }
+
+        /**
+         * @brief Check if two boxes overlap on the y axis, touching edges included.
+         */
+        bool boxes_overlap_y(const AABB& a, const AABB& b) {
+            return !(a.max.y < b.min.y || a.min.y > b.max.y);
+        }
+
+        /**
+         * @brief Get the left end of a box's x interval, treating NaN as unbounded.
+         */
+        float interval_min(const AABB& box) {
+            if (std::isnan(box.min.x) || std::isnan(box.max.x)) {
+                return -std::numeric_limits<float>::infinity();
+            }
+            return std::min(box.min.x, box.max.x);
+        }
+
+        /**
+         * @brief Get the right end of a box's x interval, treating NaN as unbounded.
+         */
+        float interval_max(const AABB& box) {
+            if (std::isnan(box.min.x) || std::isnan(box.max.x)) {
+                return std::numeric_limits<float>::infinity();
+            }
+            return std::max(box.min.x, box.max.x);
+        }
+
+        /**
+         * @brief Sort the pairs and drop duplicates.
+         */
+        void make_unique(std::vector<Candidate_Pair>& pairs) {
+            std::sort(pairs.begin(), pairs.end());
+            pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+        }
+    }
+
+    void find_pairs_brute_force(const std::vector<AABB>& boxes, std::vector<Candidate_Pair>& pairs) {
+        pairs.clear();
+        std::uint32_t count = static_cast<std::uint32_t>(boxes.size());
+        for (std::uint32_t a = 0; a < count; ++a) {
+            for (std::uint32_t b = a + 1; b < count; ++b) {
+                pairs.emplace_back(a, b);
+            }
+        }
+    }
+
+    Spatial_Hash::Spatial_Hash(float cell_size)
+        : cell_size(cell_size > 0.0f ? cell_size : DEFAULT_COLLISION_CELL_SIZE) {}
+
+    void Spatial_Hash::set_cell_size(float size) {
+        if (size > 0.0f) {
+            cell_size = size;
+        }
+    }
+
+    float Spatial_Hash::get_cell_size() const {
+        return cell_size;
+    }
+
+    void Spatial_Hash::find_pairs(const std::vector<AABB>& boxes, std::vector<Candidate_Pair>& pairs) {
+        pairs.clear();
+        entries.clear();
+        oversized.clear();
+
+        // List every box under each cell it covers
+        std::uint32_t count = static_cast<std::uint32_t>(boxes.size());
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const AABB& box = boxes[i];
+            if (!std::isfinite(box.min.x) || !std::isfinite(box.min.y) ||
+                !std::isfinite(box.max.x) || !std::isfinite(box.max.y)) {
+                oversized.push_back(i);
+                continue;
+            }
+
+            std::int64_t min_x = cell_coordinate(box.min.x, cell_size);
+            std::int64_t min_y = cell_coordinate(box.min.y, cell_size);
+            std::int64_t max_x = cell_coordinate(box.max.x, cell_size);
+            std::int64_t max_y = cell_coordinate(box.max.y, cell_size);
+            if (max_x < min_x || max_y < min_y ||
+                static_cast<std::uint64_t>(max_x - min_x + 1) * static_cast<std::uint64_t>(max_y - min_y + 1) > MAX_COLLISION_CELLS_PER_BOX) {
+                oversized.push_back(i);
+                continue;
+            }
+
+            for (std::int64_t x = min_x; x <= max_x; ++x) {
+                for (std::int64_t y = min_y; y <= max_y; ++y) {
+                    std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+                        static_cast<std::uint32_t>(y);
+                    entries.emplace_back(key, i);
+                }
+            }
+        }
+
+        // Boxes sharing a cell are adjacent after sorting, in index order within the cell
+        std::sort(entries.begin(), entries.end());
+        for (std::size_t begin = 0; begin < entries.size();) {
+            std::size_t end = begin + 1;
+            while (end < entries.size() && entries[end].first == entries[begin].first) {
+                ++end;
+            }
+
+            for (std::size_t a = begin; a < end; ++a) {
+                for (std::size_t b = a + 1; b < end; ++b) {
+                    std::uint32_t first = entries[a].second;
+                    std::uint32_t second = entries[b].second;
+                    if (boxes_overlap(boxes[first], boxes[second])) {
+                        pairs.emplace_back(first, second);
+                    }
+                }
+            }
+
+            begin = end;
+        }
+
+        // Boxes left out of the grid are checked against every box
+        for (std::uint32_t big : oversized) {
+            for (std::uint32_t other = 0; other < count; ++other) {
+                if (other != big && boxes_overlap(boxes[big], boxes[other])) {
+                    pairs.emplace_back(std::min(big, other), std::max(big, other));
+                }
+            }
+        }
+
+        // Boxes sharing several cells are paired in each of them
+        make_unique(pairs);
+    }
+
+    void Sweep_And_Prune::find_pairs(const std::vector<EntityID>& entities, const std::vector<AABB>& boxes, std::vector<Candidate_Pair>& pairs) {
+        constexpr std::uint32_t NO_BOX = std::numeric_limits<std::uint32_t>::max();
+        pairs.clear();
+
+        // Find the box of each entity slot in this query
+        std::fill(box_of_slot.begin(), box_of_slot.end(), NO_BOX);
+        std::uint32_t count = static_cast<std::uint32_t>(boxes.size());
+        for (std::uint32_t i = 0; i < count; ++i) {
+            std::uint32_t slot = entity_index(entities[i]);
+            if (slot >= box_of_slot.size()) {
+                box_of_slot.resize(slot + 1, NO_BOX);
+                tracked.resize(slot + 1, INVALID_ENTITY_ID);
+            }
+            box_of_slot[slot] = i;
+        }
+
+        // Drop the endpoints of boxes that left, or whose slot now holds another entity
+        std::size_t kept = 0;
+        for (const Endpoint& endpoint : endpoints) {
+            std::uint32_t slot = entity_index(endpoint.entity);
+            std::uint32_t box = box_of_slot[slot];
+            if (box == NO_BOX || entities[box] != endpoint.entity) {
+                tracked[slot] = INVALID_ENTITY_ID;
+                continue;
+            }
+            Endpoint& moved = endpoints[kept++];
+            moved = endpoint;
+            moved.value = endpoint.is_max ? interval_max(boxes[box]) : interval_min(boxes[box]);
+        }
+        endpoints.resize(kept);
+
+        // Append the endpoints of boxes that joined
+        std::size_t added = 0;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            std::uint32_t slot = entity_index(entities[i]);
+            if (tracked[slot] != entities[i]) {
+                tracked[slot] = entities[i];
+                endpoints.push_back({ interval_min(boxes[i]), entities[i], false });
+                endpoints.push_back({ interval_max(boxes[i]), entities[i], true });
+                added += 2;
+            }
+        }
+
+        // Left ends sort before right ends at the same x so that touching boxes overlap
+        auto endpoint_less = [](const Endpoint& a, const Endpoint& b) {
+            return a.value < b.value || (a.value == b.value && !a.is_max && b.is_max);
+        };
+
+        // Insertion sort is close to linear on the nearly sorted list, a full sort is faster after a bulk join
+        if (added * 4 > endpoints.size()) {
+            std::sort(endpoints.begin(), endpoints.end(), endpoint_less);
+        }
+        else {
+            for (std::size_t i = 1; i < endpoints.size(); ++i) {
+                Endpoint endpoint = endpoints[i];
+                std::size_t j = i;
+                while (j > 0 && endpoint_less(endpoint, endpoints[j - 1])) {
+                    endpoints[j] = endpoints[j - 1];
+                    --j;
+                }
+                endpoints[j] = endpoint;
+            }
+        }
+
+        // Sweep along x, pairing each box with the open boxes it overlaps on y
+        active.clear();
+        for (const Endpoint& endpoint : endpoints) {
+            std::uint32_t box = box_of_slot[entity_index(endpoint.entity)];
+            if (endpoint.is_max) {
+                auto it = std::find(active.begin(), active.end(), box);
+                if (it != active.end()) {
+                    *it = active.back();
+                    active.pop_back();
+                }
+                continue;
+            }
+
+            for (std::uint32_t other : active) {
+                if (boxes_overlap_y(boxes[box], boxes[other])) {
+                    pairs.emplace_back(std::min(box, other), std::max(box, other));
+                }
+            }
+            active.push_back(box);
+        }
+        std::sort(pairs.begin(), pairs.end());
+
+        // Compare the overlaps with the previous query's
+        previous.swap(overlaps);
+        overlaps.clear();
+        for (const Candidate_Pair& pair : pairs) {
+            EntityID first = entities[pair.first];
+            EntityID second = entities[pair.second];
+            overlaps.emplace_back(std::min(first, second), std::max(first, second));
+        }
+        std::sort(overlaps.begin(), overlaps.end());
+
+        began.clear();
+        ended.clear();
+        std::set_difference(overlaps.begin(), overlaps.end(), previous.begin(), previous.end(), std::back_inserter(began));
+        std::set_difference(previous.begin(), previous.end(), overlaps.begin(), overlaps.end(), std::back_inserter(ended));
+    }
+
+    const std::vector<Entity_Pair>& Sweep_And_Prune::get_overlaps() const {
+        return overlaps;
+    }
+
+    const std::vector<Entity_Pair>& Sweep_And_Prune::get_began() const {
+        return began;
+    }
+
+    const std::vector<Entity_Pair>& Sweep_And_Prune::get_ended() const {
+        return ended;
+    }
+
+    void Sweep_And_Prune::clear() {
+        endpoints.clear();
+        tracked.clear();
+        box_of_slot.clear();
+        active.clear();
+        overlaps.clear();
+        previous.clear();
+        began.clear();
+        ended.clear();
+    }
+
+    void Tree_Broadphase::find_pairs(const std::vector<EntityID>& entities, const std::vector<AABB>& boxes,
+        const std::vector<bool>& is_static, bool statics_moved, std::vector<Candidate_Pair>& pairs) {
+        constexpr std::uint32_t NO_BOX = std::numeric_limits<std::uint32_t>::max();
+        pairs.clear();
+
+        // Find the box of each entity slot in this query
+        std::fill(box_of_slot.begin(), box_of_slot.end(), NO_BOX);
+        std::uint32_t count = static_cast<std::uint32_t>(boxes.size());
+        std::size_t static_count = 0;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            std::uint32_t slot = entity_index(entities[i]);
+            if (slot >= box_of_slot.size()) {
+                box_of_slot.resize(slot + 1, NO_BOX);
+                dynamic_of_slot.resize(slot + 1, INVALID_ENTITY_ID);
+                proxy_of_slot.resize(slot + 1, AABB_Tree::NULL_NODE);
+                static_of_slot.resize(slot + 1, INVALID_ENTITY_ID);
+            }
+            box_of_slot[slot] = i;
+
+            if (is_static[i]) {
+                ++static_count;
+                statics_moved = statics_moved || static_of_slot[slot] != entities[i];
+            }
+        }
+
+        // Rebuild the static tree when a static box joined, left or moved
+        if (statics_moved || static_count != static_tree.size()) {
+            static_entities.clear();
+            static_boxes.clear();
+            std::fill(static_of_slot.begin(), static_of_slot.end(), INVALID_ENTITY_ID);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                if (is_static[i]) {
+                    static_entities.push_back(entities[i]);
+                    static_boxes.push_back(boxes[i]);
+                    static_of_slot[entity_index(entities[i])] = entities[i];
+                }
+            }
+            static_tree.build(static_entities, static_boxes);
+        }
+
+        // Drop the moving boxes that left or became static
+        std::size_t kept = 0;
+        for (EntityID entity : dynamic_entities) {
+            std::uint32_t slot = entity_index(entity);
+            std::uint32_t box = box_of_slot[slot];
+            if (box != NO_BOX && entities[box] == entity && !is_static[box]) {
+                dynamic_entities[kept++] = entity;
+                continue;
+            }
+            dynamic_tree.destroy_proxy(proxy_of_slot[slot]);
+            dynamic_of_slot[slot] = INVALID_ENTITY_ID;
+            proxy_of_slot[slot] = AABB_Tree::NULL_NODE;
+        }
+        dynamic_entities.resize(kept);
+
+        // Add the moving boxes that joined and move the rest
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (is_static[i]) {
+                continue;
+            }
+            std::uint32_t slot = entity_index(entities[i]);
+            if (dynamic_of_slot[slot] == entities[i]) {
+                dynamic_tree.move_proxy(proxy_of_slot[slot], boxes[i]);
+            }
+            else {
+                proxy_of_slot[slot] = dynamic_tree.create_proxy(entities[i], boxes[i]);
+                dynamic_of_slot[slot] = entities[i];
+                dynamic_entities.push_back(entities[i]);
+            }
+        }
+
+        // Pairs come out of the trees by enlarged box, so keep the ones whose boxes overlap now
+        auto add_pair = [&](EntityID first, EntityID second) {
+            std::uint32_t a = box_of_slot[entity_index(first)];
+            std::uint32_t b = box_of_slot[entity_index(second)];
+            if (boxes_overlap(boxes[a], boxes[b])) {
+                pairs.emplace_back(std::min(a, b), std::max(a, b));
+            }
+        };
+
+        entity_pairs.clear();
+        dynamic_tree.query_pairs(entity_pairs);
+        for (const Entity_Pair& pair : entity_pairs) {
+            add_pair(pair.first, pair.second);
+        }
+
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (is_static[i]) {
+                continue;
+            }
+            found.clear();
+            static_tree.query(boxes[i], found);
+            for (EntityID other : found) {
+                add_pair(entities[i], other);
+            }
+        }
+
+        std::sort(pairs.begin(), pairs.end());
+    }
+
+    const AABB_Tree& Tree_Broadphase::get_dynamic_tree() const {
+        return dynamic_tree;
+    }
+
+    const AABB_Tree& Tree_Broadphase::get_static_tree() const {
+        return static_tree;
+    }
+
+    void Tree_Broadphase::clear() {
+        dynamic_tree.clear();
+        static_tree.clear();
+        dynamic_of_slot.clear();
+        proxy_of_slot.clear();
+        dynamic_entities.clear();
+        static_of_slot.clear();
+        box_of_slot.clear();
+    }
+
+} // namespace lof
@@ -0,0 +1,215 @@
+/**
+ * @file Broadphase.h
+ * @brief Declares the broadphases that find candidate collision pairs for the Collision_System.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_BROADPHASE_H
+#define LOF_BROADPHASE_H
+
+// Include standard headers
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Include other necessary headers
+#include "../Utility/Constant.h"
+#include "../Utility/Type.h" // For EntityID
+#include "AABB_Tree.h"
+
+namespace lof {
+
+    struct AABB;
+
+    /**
+     * @typedef Candidate_Pair
+     * @brief Indices of two boxes that may overlap, the smaller index first.
+     */
+    using Candidate_Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+    /**
+     * @enum Broadphase_Type
+     * @brief The method the Collision_System uses to find candidate pairs.
+     */
+    enum class Broadphase_Type {
+        BRUTE_FORCE,    ///< Every pair of boxes, kept as a reference
+        SPATIAL_HASH,   ///< Boxes sharing a cell of a uniform grid
+        SWEEP_AND_PRUNE,///< Boxes whose x intervals overlap, kept sorted between updates
+        AABB_TREE       ///< Moving boxes in a dynamic tree, static boxes in a tree built once
+    };
+
+    /**
+     * @brief Find every pair of boxes.
+     * @param boxes The boxes to pair.
+     * @param pairs Output for the pairs, replacing its contents, sorted and unique.
+     */
+    void find_pairs_brute_force(const std::vector<AABB>& boxes, std::vector<Candidate_Pair>& pairs);
+
+    /**
+     * @class Spatial_Hash
+     * @brief Uniform grid broadphase, rebuilt from the boxes on every query.
+     * @details Each box is listed once for every cell it covers. The entries are sorted by cell, so
+     *          boxes sharing a cell end up next to each other, and the overlapping pairs in each run
+     *          are collected and made unique. Boxes covering more than MAX_COLLISION_CELLS_PER_BOX
+     *          cells, or with non-finite bounds, are paired with every box instead. The entry arrays
+     *          are kept between queries so rebuilding does not allocate once they have grown.
+     */
+    class Spatial_Hash {
+    private:
+        float cell_size;                                                ///< Width and height of a cell in world units
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> entries;   ///< Cell key and box index of every covered cell
+        std::vector<std::uint32_t> oversized;                           ///< Boxes left out of the grid
+
+    public:
+        /**
+         * @brief Constructor for Spatial_Hash.
+         * @param cell_size Width and height of a cell in world units.
+         */
+        explicit Spatial_Hash(float cell_size = DEFAULT_COLLISION_CELL_SIZE);
+
+        /**
+         * @brief Set the cell size.
+         * @details Cells around the size of a typical collider give the fewest candidates.
+         * @param size Width and height of a cell in world units, ignored if not positive.
+         */
+        void set_cell_size(float size);
+
+        /**
+         * @brief Get the cell size.
+         * @return Width and height of a cell in world units.
+         */
+        float get_cell_size() const;
+
+        /**
+         * @brief Find the pairs of boxes that overlap.
+         * @param boxes The boxes to pair.
+         * @param pairs Output for the pairs, replacing its contents, sorted and unique.
+         */
+        void find_pairs(const std::vector<AABB>& boxes, std::vector<Candidate_Pair>& pairs);
+    };
+
+    /**
+     * @class Sweep_And_Prune
+     * @brief Sweep-and-prune broadphase keeping its sorted x endpoints between queries.
+     * @details Boxes are tracked by entity, so the endpoint list survives entities joining, leaving
+     *          and being reordered. Each query refreshes the endpoint values and re-sorts them with
+     *          an insertion sort, which is close to linear when boxes only move a little between
+     *          queries. A sweep over the endpoints then pairs the boxes whose x intervals overlap,
+     *          checking y as they are paired. The overlapping pairs are kept by entity, and the pairs
+     *          that began and ended overlapping since the previous query are reported.
+     */
+    class Sweep_And_Prune {
+    private:
+        /**
+         * @struct Endpoint
+         * @brief One end of a box's x interval.
+         */
+        struct Endpoint {
+            float value;        ///< x coordinate of the end
+            EntityID entity;    ///< Entity owning the box
+            bool is_max;        ///< True for the right end, false for the left end
+        };
+
+        std::vector<Endpoint> endpoints;            ///< Endpoints of every tracked box, sorted by x
+        std::vector<EntityID> tracked;              ///< Entity tracked in each entity slot, INVALID_ENTITY_ID if none
+        std::vector<std::uint32_t> box_of_slot;     ///< Index of each entity slot's box in the current query
+        std::vector<std::uint32_t> active;          ///< Boxes whose interval contains the sweep position
+        std::vector<Entity_Pair> overlaps;          ///< Overlapping pairs from the last query, sorted
+        std::vector<Entity_Pair> previous;          ///< Overlapping pairs from the query before
+        std::vector<Entity_Pair> began;             ///< Pairs overlapping in the last query but not the one before
+        std::vector<Entity_Pair> ended;             ///< Pairs overlapping in the query before but not the last one
+
+    public:
+        /**
+         * @brief Find the pairs of boxes that overlap and update the overlap events.
+         * @param entities The entity owning each box.
+         * @param boxes The boxes to pair.
+         * @param pairs Output for the pairs, replacing its contents, sorted and unique.
+         */
+        void find_pairs(const std::vector<EntityID>& entities, const std::vector<AABB>& boxes, std::vector<Candidate_Pair>& pairs);
+
+        /**
+         * @brief Get the pairs of entities overlapping in the last query.
+         * @return The pairs, sorted.
+         */
+        const std::vector<Entity_Pair>& get_overlaps() const;
+
+        /**
+         * @brief Get the pairs of entities that started overlapping in the last query.
+         * @return The pairs, sorted.
+         */
+        const std::vector<Entity_Pair>& get_began() const;
+
+        /**
+         * @brief Get the pairs of entities that stopped overlapping in the last query.
+         * @details Includes pairs with an entity that was not in the last query.
+         * @return The pairs, sorted.
+         */
+        const std::vector<Entity_Pair>& get_ended() const;
+
+        /**
+         * @brief Forget every tracked box and overlap.
+         */
+        void clear();
+    };
+
+    /**
+     * @class Tree_Broadphase
+     * @brief AABB tree broadphase with separate trees for moving and static boxes.
+     * @details Moving boxes live in a tree with enlarged leaves and are reinserted only when they
+     *          leave them. Static boxes live in a tight tree built in one pass, rebuilt only when the
+     *          set of static boxes changes or the caller reports that one of them moved. Pairs are
+     *          found between moving boxes and from each moving box into the static tree, since two
+     *          static boxes never need testing.
+     */
+    class Tree_Broadphase {
+    private:
+        AABB_Tree dynamic_tree{ DEFAULT_AABB_TREE_MARGIN };     ///< Boxes of moving entities
+        AABB_Tree static_tree;                                  ///< Boxes of static entities
+        std::vector<EntityID> dynamic_of_slot;                  ///< Moving entity tracked in each entity slot
+        std::vector<std::int32_t> proxy_of_slot;                ///< Dynamic tree proxy of each entity slot
+        std::vector<EntityID> dynamic_entities;                 ///< Moving entities in the dynamic tree
+        std::vector<EntityID> static_of_slot;                   ///< Static entity in the static tree for each entity slot
+        std::vector<std::uint32_t> box_of_slot;                 ///< Index of each entity slot's box in the current query
+        std::vector<EntityID> static_entities;                  ///< Scratch list of the static entities
+        std::vector<AABB> static_boxes;                         ///< Scratch list of the static boxes
+        std::vector<EntityID> found;                            ///< Scratch list of query results
+        std::vector<Entity_Pair> entity_pairs;                  ///< Scratch list of pairs from the dynamic tree
+
+    public:
+        /**
+         * @brief Find the pairs of boxes that overlap and have at least one moving box.
+         * @param entities The entity owning each box.
+         * @param boxes The boxes to pair.
+         * @param is_static Whether each box belongs to a static entity.
+         * @param statics_moved True if a static box may differ from the one in the static tree.
+         * @param pairs Output for the pairs, replacing its contents, sorted and unique.
+         */
+        void find_pairs(const std::vector<EntityID>& entities, const std::vector<AABB>& boxes,
+            const std::vector<bool>& is_static, bool statics_moved, std::vector<Candidate_Pair>& pairs);
+
+        /**
+         * @brief Get the tree of moving boxes, for box and ray queries.
+         * @return Const reference to the dynamic tree.
+         */
+        const AABB_Tree& get_dynamic_tree() const;
+
+        /**
+         * @brief Get the tree of static boxes, for box and ray queries.
+         * @return Const reference to the static tree.
+         */
+        const AABB_Tree& get_static_tree() const;
+
+        /**
+         * @brief Forget every tracked box.
+         */
+        void clear();
+    };
+
+} // namespace lof
+
+#endif // LOF_BROADPHASE_H
@@ -0,0 +1,327 @@
+/**
+ * @file Collision_Batch.cpp
+ * @brief Implements the batched narrowphase that tests one box against many candidates with SIMD.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Collision_Batch.h"
+
+// Include other necessary headers
+#include "AABB.h"
+#include "Collision_Lanes.h"
+
+// SSE2 is part of every x64 processor, and of the x86 targets built with it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LOF_COLLISION_BATCH_SSE2 1
+#else
+#define LOF_COLLISION_BATCH_SSE2 0
+#endif
+
+// Include standard headers
+#if LOF_COLLISION_BATCH_SSE2
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace lof {
+
+    namespace {
+#if LOF_COLLISION_BATCH_SSE2
+        /**
+         * @struct Sse2_Lanes
+         * @brief Four candidates at a time with SSE2.
+         */
+        struct Sse2_Lanes {
+            using Float = __m128;
+            using Mask = __m128;
+            static constexpr std::size_t WIDTH = 4;
+
+            static Float load(const float* values) { return _mm_loadu_ps(values); }
+            static Float set(float value) { return _mm_set1_ps(value); }
+            static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+            static Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+            static Mask less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+            static Mask greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+            static Mask equal(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+            static Mask both(Mask a, Mask b) { return _mm_and_ps(a, b); }
+            static Mask either(Mask a, Mask b) { return _mm_or_ps(a, b); }
+            static Float select(Mask mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+            static bool all(Mask mask) { return _mm_movemask_ps(mask) == 0xF; }
+            static void store_hits(Mask miss, std::uint8_t* hits) {
+                int bits = _mm_movemask_ps(miss);
+                for (std::size_t lane = 0; lane < WIDTH; ++lane) {
+                    hits[lane] = ((bits >> lane) & 1) ? 0 : 1;
+                }
+            }
+            static void store(float* values, Float value) { _mm_storeu_ps(values, value); }
+        };
+#endif
+
+        /**
+         * @brief Check if the processor and operating system support AVX2.
+         */
+        bool cpu_supports_avx2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) {
+                return false;
+            }
+
+            // The processor must support AVX, and the operating system must save the YMM registers
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+                return false;
+            }
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+#else
+            return false;
+#endif
+        }
+    }
+
+    void Collider_Arrays::clear() {
+        min_x.clear();
+        min_y.clear();
+        max_x.clear();
+        max_y.clear();
+        vel_x.clear();
+        vel_y.clear();
+    }
+
+    void Collider_Arrays::add(const AABB& box, const Vec2D& velocity) {
+        min_x.push_back(box.min.x);
+        min_y.push_back(box.min.y);
+        max_x.push_back(box.max.x);
+        max_y.push_back(box.max.y);
+        vel_x.push_back(velocity.x);
+        vel_y.push_back(velocity.y);
+    }
+
+    std::size_t Collider_Arrays::size() const {
+        return min_x.size();
+    }
+
+    bool collision_batch_supported(Collision_Batch_Path path) {
+        switch (path) {
+        case Collision_Batch_Path::SCALAR:
+            return true;
+        case Collision_Batch_Path::SSE2:
+            return LOF_COLLISION_BATCH_SSE2 != 0;
+        case Collision_Batch_Path::AVX2:
+        {
+            static const bool supported = COLLISION_LANES_AVX2_BUILT && cpu_supports_avx2();
+            return supported;
+        }
+        }
+        return false;
+    }
+
+    Collision_Batch_Path collision_batch_best_path() {
+        static const Collision_Batch_Path best =
+            collision_batch_supported(Collision_Batch_Path::AVX2) ? Collision_Batch_Path::AVX2 :
+            collision_batch_supported(Collision_Batch_Path::SSE2) ? Collision_Batch_Path::SSE2 :
+            Collision_Batch_Path::SCALAR;
+        return best;
+    }
+
+    bool collision_intersection_pair(const AABB& aabb1,
+        const Vec2D& vel1,
+        const AABB& aabb2,
+        const Vec2D& vel2,
+        float& firstTimeOfCollision,
+        float delta_time) {
+        // Check for AABB intersection
+        //check for A.max < B.min or A.min > B.min for x axis & y axis
+        if (aabb1.max.x < aabb2.min.x || aabb1.min.x > aabb2.max.x ||
+            aabb1.max.y < aabb2.min.y || aabb1.min.y > aabb2.max.y)
+        {
+            return false; //no intersection
+        }
+
+        float Vb_x = vel2.x - vel1.x; //initialize Vb for x axis 
+        float Vb_y = vel2.y - vel1.y; //initialize Vb for y axis
+
+        float dFirst_x = aabb1.max.x - aabb2.min.x;  //initialize for dFirst for x-axis
+        float dFirst_y = aabb1.max.y - aabb2.min.y; // initialize for dFrist for y axis
+        float dLast_x = aabb1.min.x - aabb2.max.x; //initialize for dLast for x axis
+        float dLast_y = aabb1.min.y - aabb2.max.y; //initialize for dLast for y axis
+
+        float tFirst = firstTimeOfCollision = 0.0f; //Initialise t first
+        float tLast = delta_time; //initialize tLast and assume 1 as the time step (g_dt)
+
+        //for x-axis
+        if (Vb_x < 0)
+        {
+            //case 1 for x-axis
+            if (aabb1.min.x > aabb2.max.x)
+            {
+                return false;
+            }
+            //case 4 for x-axis
+            if (aabb1.max.x < aabb2.min.x)
+            {
+                if (tFirst < dFirst_x / Vb_x)
+                {
+                    tFirst = dFirst_x / Vb_x;
+                }
+            }
+
+            if (aabb1.min.x < aabb2.max.x)
+            {
+                if (tLast > dLast_x / Vb_x)
+                {
+                    tLast = dLast_x / Vb_x;
+                }
+            }
+        }
+        else if (Vb_x > 0)
+        {
+            //case 2 for x_axis
+            if (aabb1.min.x > aabb2.max.x)
+            {
+                if (tFirst < dLast_x / Vb_x)
+                {
+                    tFirst = dLast_x / Vb_x;
+                }
+            }
+            if (aabb1.max.x > aabb2.min.x)
+            {
+                if (tLast > dFirst_x / Vb_x)
+                {
+                    tLast = dFirst_x / Vb_x;
+                }
+            }
+
+            //case 3
+            if (aabb1.max.x < aabb2.min.x)
+            {
+                return false;
+            }
+
+        }
+        else if (Vb_x == 0) {
+            //case 5;
+            if (aabb1.max.x < aabb2.min.x)
+            {
+                return false;
+            }
+            else if (aabb1.min.x > aabb2.max.x)
+            {
+                return false;
+            }
+        }
+
+        //for y-axis
+        if (Vb_y < 0)
+        {
+            //case 1 for y-axis
+            if (aabb1.min.y > aabb2.max.y)
+            {
+                return false;
+            }
+            //case 4 for y-axis
+            if (aabb1.max.y < aabb2.min.y)
+            {
+                if (tFirst < dFirst_y / Vb_y)
+                {
+                    tFirst = dFirst_y / Vb_y;
+                }
+            }
+            if (aabb1.min.y < aabb2.max.y)
+            {
+                if (tLast > dLast_y / Vb_y)
+                {
+                    tLast = dLast_y / Vb_y;
+                }
+            }
+        }
+        else if (Vb_y > 0)
+        {
+            //case 2 for y-axis
+            if (aabb1.min.y > aabb2.max.y)
+            {
+                if (tFirst < dLast_y / Vb_y)
+                {
+                    tFirst = dLast_y / Vb_y;
+                }
+            }
+            if (aabb1.max.y > aabb2.min.y)
+            {
+                if (tLast > dFirst_y / Vb_y)
+                {
+                    tLast = dFirst_y / Vb_y;
+                }
+            }
+            //case 3
+            if (aabb1.max.y < aabb2.min.y)
+            {
+                return false;
+            }
+        }
+        else if (Vb_y == 0) {
+            //case 5;
+            if (aabb1.max.y < aabb2.min.y)
+            {
+                return false;
+            }
+            else if (aabb1.min.y > aabb2.max.y)
+            {
+                return false;
+            }
+        }
+        //case 6; 
+        if (tFirst > tLast)
+        {
+            return false;
+        }
+
+        firstTimeOfCollision = tFirst;
+        return true; //the rectangle intersect
+    }
+
+    void collision_intersection_batch(const AABB& box, const Vec2D& velocity, const Collider_Arrays& candidates,
+        float delta_time, std::vector<std::uint8_t>& hits, std::vector<float>& first_contact) {
+        collision_intersection_batch(box, velocity, candidates, delta_time, hits, first_contact, collision_batch_best_path());
+    }
+
+    void collision_intersection_batch(const AABB& box, const Vec2D& velocity, const Collider_Arrays& candidates,
+        float delta_time, std::vector<std::uint8_t>& hits, std::vector<float>& first_contact, Collision_Batch_Path path) {
+        std::size_t count = candidates.size();
+        hits.resize(count);
+        first_contact.resize(count);
+
+        Collision_Batch_Input input{ box.min.x, box.min.y, box.max.x, box.max.y, velocity.x, velocity.y,
+            candidates.min_x.data(), candidates.min_y.data(), candidates.max_x.data(), candidates.max_y.data(),
+            candidates.vel_x.data(), candidates.vel_y.data(), count, delta_time, hits.data(), first_contact.data() };
+
+        std::size_t index = 0;
+        if (!collision_batch_supported(path)) {
+            path = Collision_Batch_Path::SCALAR;
+        }
+        if (path == Collision_Batch_Path::AVX2) {
+            index = test_candidates_avx2(input);
+        }
+#if LOF_COLLISION_BATCH_SSE2
+        if (path == Collision_Batch_Path::SSE2) {
+            index = test_candidates<Sse2_Lanes>(input, index);
+        }
+#endif
+        test_candidates<Scalar_Lanes>(input, index);
+    }
+
+} // namespace lof
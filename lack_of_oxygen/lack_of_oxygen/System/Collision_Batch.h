@@ -0,0 +1,122 @@
+/**
+ * @file Collision_Batch.h
+ * @brief Declares the batched narrowphase that tests one box against many candidates with SIMD.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_COLLISION_BATCH_H
+#define LOF_COLLISION_BATCH_H
+
+// Include standard headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Include other necessary headers
+#include "../Utility/Vector2D.h"
+
+namespace lof {
+
+    struct AABB;
+
+    /**
+     * @enum Collision_Batch_Path
+     * @brief The instruction sets the batched narrowphase can test candidates with.
+     */
+    enum class Collision_Batch_Path {
+        SCALAR,     ///< One candidate at a time
+        SSE2,       ///< Four candidates at a time
+        AVX2        ///< Eight candidates at a time
+    };
+
+    /**
+     * @struct Collider_Arrays
+     * @brief Boxes and velocities of collision candidates, one array per coordinate.
+     * @details Storing each coordinate contiguously lets the batched test load several candidates
+     *          into one register. Filled once per tested entity and reused, so it does not allocate
+     *          once it has grown.
+     */
+    struct Collider_Arrays {
+        std::vector<float> min_x;   ///< Minimum x of each box
+        std::vector<float> min_y;   ///< Minimum y of each box
+        std::vector<float> max_x;   ///< Maximum x of each box
+        std::vector<float> max_y;   ///< Maximum y of each box
+        std::vector<float> vel_x;   ///< Velocity x of each candidate
+        std::vector<float> vel_y;   ///< Velocity y of each candidate
+
+        /**
+         * @brief Remove every candidate.
+         */
+        void clear();
+
+        /**
+         * @brief Add a candidate.
+         * @param box The candidate's box.
+         * @param velocity The candidate's velocity.
+         */
+        void add(const AABB& box, const Vec2D& velocity);
+
+        /**
+         * @brief Get the number of candidates.
+         * @return The number of candidates added since the last clear().
+         */
+        std::size_t size() const;
+    };
+
+    /**
+     * @brief Check if the batched narrowphase can use a path on this build and processor.
+     * @param path The path to check.
+     * @return True if the path is built in and the processor supports its instruction set.
+     */
+    bool collision_batch_supported(Collision_Batch_Path path);
+
+    /**
+     * @brief Get the widest path the batched narrowphase can use, checked once.
+     * @return The path collision_intersection_batch() uses when none is given.
+     */
+    Collision_Batch_Path collision_batch_best_path();
+
+    /**
+     * @brief Check for intersection between two moving rectangles, one pair at a time.
+     * @param aabb1 First AABB.
+     * @param vel1 First velocity.
+     * @param aabb2 Second AABB.
+     * @param vel2 Second velocity.
+     * @param firstTimeOfCollision Output param to hold the time of first contact, if they intersect.
+     * @param delta_time The length of the time step.
+     * @return True if rectangles intersect, false otherwise.
+     */
+    bool collision_intersection_pair(const AABB& aabb1, const Vec2D& vel1, const AABB& aabb2, const Vec2D& vel2,
+        float& firstTimeOfCollision, float delta_time);
+
+    /**
+     * @brief Test a moving box against every candidate, as collision_intersection_pair() would one pair at a time.
+     * @details Candidates are tested eight at a time with AVX2 or four at a time with SSE2, whichever
+     *          collision_batch_best_path() picked, and the rest one at a time with the same steps, so
+     *          every result matches the per-pair test bit for bit, NaN bounds included.
+     * @param box The moving box.
+     * @param velocity The moving box's velocity.
+     * @param candidates The candidates to test against.
+     * @param delta_time The length of the time step.
+     * @param hits Output for whether each candidate intersects, replacing its contents.
+     * @param first_contact Output for the time of first contact with each hit candidate, replacing its contents.
+     */
+    void collision_intersection_batch(const AABB& box, const Vec2D& velocity, const Collider_Arrays& candidates,
+        float delta_time, std::vector<std::uint8_t>& hits, std::vector<float>& first_contact);
+
+    /**
+     * @brief Test a moving box against every candidate with a given path.
+     * @details Used to compare the paths against each other. A path that is not supported falls
+     *          back to Collision_Batch_Path::SCALAR.
+     * @param path The path to test with.
+     */
+    void collision_intersection_batch(const AABB& box, const Vec2D& velocity, const Collider_Arrays& candidates,
+        float delta_time, std::vector<std::uint8_t>& hits, std::vector<float>& first_contact, Collision_Batch_Path path);
+
+} // namespace lof
+
+#endif // LOF_COLLISION_BATCH_H
@@ -0,0 +1,72 @@
+/**
+ * @file Collision_Batch_AVX2.cpp
+ * @brief Implements the AVX2 lanes of the batched narrowphase, compiled for AVX2 on its own.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Collision_Lanes.h"
+
+// This file alone is built with /arch:AVX2, and only called once the processor is known to
+// support AVX2, so the rest of the program still runs on processors without it
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace lof {
+
+#if defined(__AVX2__)
+    const bool COLLISION_LANES_AVX2_BUILT = true;
+
+    namespace {
+        /**
+         * @struct Avx2_Lanes
+         * @brief Eight candidates at a time with AVX2.
+         */
+        struct Avx2_Lanes {
+            using Float = __m256;
+            using Mask = __m256;
+            static constexpr std::size_t WIDTH = 8;
+
+            static Float load(const float* values) { return _mm256_loadu_ps(values); }
+            static Float set(float value) { return _mm256_set1_ps(value); }
+            static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+            static Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+            // Ordered, non-signalling comparisons are false for NaN, like the scalar operators
+            static Mask less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static Mask greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+            static Mask equal(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+            static Mask both(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+            static Mask either(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+            static Float select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+            static bool all(Mask mask) { return _mm256_movemask_ps(mask) == 0xFF; }
+            static void store_hits(Mask miss, std::uint8_t* hits) {
+                int bits = _mm256_movemask_ps(miss);
+                for (std::size_t lane = 0; lane < WIDTH; ++lane) {
+                    hits[lane] = ((bits >> lane) & 1) ? 0 : 1;
+                }
+            }
+            static void store(float* values, Float value) { _mm256_storeu_ps(values, value); }
+        };
+    }
+
+    std::size_t test_candidates_avx2(const Collision_Batch_Input& input) {
+        std::size_t tested = test_candidates<Avx2_Lanes>(input, 0);
+
+        // Clear the upper halves of the registers before returning to SSE code
+        _mm256_zeroupper();
+        return tested;
+    }
+#else
+    const bool COLLISION_LANES_AVX2_BUILT = false;
+
+    std::size_t test_candidates_avx2(const Collision_Batch_Input&) {
+        return 0;
+    }
+#endif
+
+} // namespace lof
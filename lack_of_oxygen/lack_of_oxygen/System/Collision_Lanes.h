@@ -0,0 +1,171 @@
+/**
+ * @file Collision_Lanes.h
+ * @brief Shares the lane-generic steps of the batched narrowphase between its instruction set files.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_COLLISION_LANES_H
+#define LOF_COLLISION_LANES_H
+
+// Include standard headers
+#include <cstddef>
+#include <cstdint>
+
+// Only included by Collision_Batch.cpp and Collision_Batch_AVX2.cpp. The AVX2 file is compiled for
+// AVX2, so this header keeps to plain data and its own functions: an inline function from another
+// header compiled there could be the copy the linker keeps for the whole program.
+namespace lof {
+
+    /**
+     * @struct Collision_Batch_Input
+     * @brief The moving box, its candidates and the outputs of one batched test, as plain pointers.
+     */
+    struct Collision_Batch_Input {
+        float min_x;                    ///< Minimum x of the moving box
+        float min_y;                    ///< Minimum y of the moving box
+        float max_x;                    ///< Maximum x of the moving box
+        float max_y;                    ///< Maximum y of the moving box
+        float vel_x;                    ///< Velocity x of the moving box
+        float vel_y;                    ///< Velocity y of the moving box
+        const float* cand_min_x;        ///< Minimum x of each candidate
+        const float* cand_min_y;        ///< Minimum y of each candidate
+        const float* cand_max_x;        ///< Maximum x of each candidate
+        const float* cand_max_y;        ///< Maximum y of each candidate
+        const float* cand_vel_x;        ///< Velocity x of each candidate
+        const float* cand_vel_y;        ///< Velocity y of each candidate
+        std::size_t count;              ///< Number of candidates
+        float delta_time;               ///< Length of the time step
+        std::uint8_t* hits;             ///< Output for whether each candidate intersects
+        float* first_contact;           ///< Output for the time of first contact with each candidate
+    };
+
+    /**
+     * @brief Whether Collision_Batch_AVX2.cpp was compiled with AVX2, so its lanes can be used.
+     */
+    extern const bool COLLISION_LANES_AVX2_BUILT;
+
+    /**
+     * @brief Test candidates eight at a time with AVX2, from the first until fewer than eight are left.
+     * @param input The batch to test.
+     * @return The number of candidates tested, the rest being left for the scalar lanes.
+     */
+    std::size_t test_candidates_avx2(const Collision_Batch_Input& input);
+
+    // Internal to each file including this header, so each instruction set keeps its own copy
+    namespace {
+        /**
+         * @struct Scalar_Lanes
+         * @brief One candidate at a time, for the scalar path and the candidates left over after the wide lanes.
+         */
+        struct Scalar_Lanes {
+            using Float = float;
+            using Mask = bool;
+            static constexpr std::size_t WIDTH = 1;
+
+            static Float load(const float* values) { return *values; }
+            static Float set(float value) { return value; }
+            static Float sub(Float a, Float b) { return a - b; }
+            // The quotient is only selected when the divisor is non-zero
+            static Float div(Float a, Float b) { return b != 0.0f ? a / b : 0.0f; }
+            static Mask less(Float a, Float b) { return a < b; }
+            static Mask greater(Float a, Float b) { return a > b; }
+            static Mask equal(Float a, Float b) { return a == b; }
+            static Mask both(Mask a, Mask b) { return a && b; }
+            static Mask either(Mask a, Mask b) { return a || b; }
+            static Float select(Mask mask, Float a, Float b) { return mask ? a : b; }
+            static bool all(Mask mask) { return mask; }
+            static void store_hits(Mask miss, std::uint8_t* hits) { *hits = miss ? 0 : 1; }
+            static void store(float* values, Float value) { *values = value; }
+        };
+
+        /**
+         * @brief Narrow the contact times along one axis, following the per-pair test's cases.
+         * @details Every case is computed and kept where it applies, instead of branching on it.
+         */
+        template<typename Lanes>
+        void sweep_axis(typename Lanes::Float a_min, typename Lanes::Float a_max,
+            typename Lanes::Float b_min, typename Lanes::Float b_max, typename Lanes::Float relative_velocity,
+            typename Lanes::Float& t_first, typename Lanes::Float& t_last, typename Lanes::Mask& miss) {
+            const typename Lanes::Float zero = Lanes::set(0.0f);
+            auto closing = Lanes::less(relative_velocity, zero);
+            auto opening = Lanes::greater(relative_velocity, zero);
+            auto still = Lanes::equal(relative_velocity, zero);
+
+            auto a_after_b = Lanes::greater(a_min, b_max);
+            auto a_before_b = Lanes::less(a_max, b_min);
+            auto first_time = Lanes::div(Lanes::sub(a_max, b_min), relative_velocity);
+            auto last_time = Lanes::div(Lanes::sub(a_min, b_max), relative_velocity);
+
+            // Cases 1 and 4
+            miss = Lanes::either(miss, Lanes::both(closing, a_after_b));
+            t_first = Lanes::select(Lanes::both(Lanes::both(closing, a_before_b), Lanes::less(t_first, first_time)), first_time, t_first);
+            t_last = Lanes::select(Lanes::both(Lanes::both(closing, Lanes::less(a_min, b_max)), Lanes::greater(t_last, last_time)), last_time, t_last);
+
+            // Cases 2 and 3
+            t_first = Lanes::select(Lanes::both(Lanes::both(opening, a_after_b), Lanes::less(t_first, last_time)), last_time, t_first);
+            t_last = Lanes::select(Lanes::both(Lanes::both(opening, Lanes::greater(a_max, b_min)), Lanes::greater(t_last, first_time)), first_time, t_last);
+            miss = Lanes::either(miss, Lanes::both(opening, a_before_b));
+
+            // Case 5
+            miss = Lanes::either(miss, Lanes::both(still, Lanes::either(a_before_b, a_after_b)));
+        }
+
+        /**
+         * @brief Test the moving box against the Lanes::WIDTH candidates starting at an index.
+         */
+        template<typename Lanes>
+        void test_lanes(const Collision_Batch_Input& input, std::size_t index) {
+            auto a_min_x = Lanes::set(input.min_x);
+            auto a_min_y = Lanes::set(input.min_y);
+            auto a_max_x = Lanes::set(input.max_x);
+            auto a_max_y = Lanes::set(input.max_y);
+            auto b_min_x = Lanes::load(input.cand_min_x + index);
+            auto b_min_y = Lanes::load(input.cand_min_y + index);
+            auto b_max_x = Lanes::load(input.cand_max_x + index);
+            auto b_max_y = Lanes::load(input.cand_max_y + index);
+
+            // Boxes that do not overlap now are rejected before the swept test
+            auto miss = Lanes::either(
+                Lanes::either(Lanes::less(a_max_x, b_min_x), Lanes::greater(a_min_x, b_max_x)),
+                Lanes::either(Lanes::less(a_max_y, b_min_y), Lanes::greater(a_min_y, b_max_y)));
+
+            auto t_first = Lanes::set(0.0f);
+            if (Lanes::all(miss)) {
+                Lanes::store_hits(miss, input.hits + index);
+                Lanes::store(input.first_contact + index, t_first);
+                return;
+            }
+
+            auto t_last = Lanes::set(input.delta_time);
+            sweep_axis<Lanes>(a_min_x, a_max_x, b_min_x, b_max_x,
+                Lanes::sub(Lanes::load(input.cand_vel_x + index), Lanes::set(input.vel_x)), t_first, t_last, miss);
+            sweep_axis<Lanes>(a_min_y, a_max_y, b_min_y, b_max_y,
+                Lanes::sub(Lanes::load(input.cand_vel_y + index), Lanes::set(input.vel_y)), t_first, t_last, miss);
+
+            // Case 6
+            miss = Lanes::either(miss, Lanes::greater(t_first, t_last));
+
+            Lanes::store_hits(miss, input.hits + index);
+            Lanes::store(input.first_contact + index, t_first);
+        }
+
+        /**
+         * @brief Test candidates Lanes::WIDTH at a time, from an index until fewer than Lanes::WIDTH are left.
+         * @return The index of the first candidate left untested.
+         */
+        template<typename Lanes>
+        std::size_t test_candidates(const Collision_Batch_Input& input, std::size_t index) {
+            for (; index + Lanes::WIDTH <= input.count; index += Lanes::WIDTH) {
+                test_lanes<Lanes>(input, index);
+            }
+            return index;
+        }
+    }
+
+} // namespace lof
+
+#endif // LOF_COLLISION_LANES_H
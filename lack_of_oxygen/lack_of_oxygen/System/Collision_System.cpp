@@ -12,6 +12,8 @@
 
 
  // Include standard headers
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 // Include headers
@@ -44,22 +46,6 @@ namespace lof {
 
  
 
-    AABB::AABB(const Vec2D& min, const Vec2D& max)
-        : min(min), max(max) {}
-
-    AABB AABB::from_transform(const Transform2D& transform, const Collision_Component& collision) {
-        Vec2D min;
-        Vec2D max;
-
-        min.x = transform.prev_position.x - (collision.width / 2.0f);
-        min.y = transform.prev_position.y - (collision.height / 2.0f);
-
-        max.x = transform.prev_position.x + (collision.width / 2.0f);
-        max.y = transform.prev_position.y + (collision.height / 2.0f);
-
-        return AABB(min, max);
-    }
-
     Collision_System::Collision_System() {
         // Set the required components for this system
         signature.set(ECSM.get_component_id<Transform2D>()); // simon
@@ -67,259 +53,283 @@ namespace lof {
         signature.set(ECSM.get_component_id<Physics_Component>()); // simon
         signature.set(ECSM.get_component_id<Velocity_Component>()); // simon
 
+        // Level geometry baked into the tile layer is tested through the layer instead
+        exclude_signature.set(ECSM.get_component_id<Tile_Tag>());
+
+        // Set the components accessed during update, mouse picking queries GLFW so stay on the main thread
+        read_signature.set(ECSM.get_component_id<Collision_Component>());
+        write_signature.set(ECSM.get_component_id<Transform2D>());
+        write_signature.set(ECSM.get_component_id<Physics_Component>());
+        write_signature.set(ECSM.get_component_id<Velocity_Component>());
+        main_thread_only = true;
+
+        // The list is kept in creation order, since collisions are resolved in the order it is visited
+
         LM.write_log("Collision_System initialized with signature requiring Transform2D, Collision_Component, Physics_Component, and Velocity_Component."); //simon
     }
 
     std::string Collision_System::get_type() const {
         return "Collision_System";
     }
- 
-    void Collision_System::collision_check_collide(std::vector<CollisionPair>& collisions, float delta_time) {
-        // Iterate over entities matching the system's signature
-        const auto& collision_entities = get_entities();
-        //std::cout << "Total entities: " << entities.size() << "\n";
-
-        for (auto it_1 = collision_entities.begin(); it_1 != collision_entities.end(); ++it_1) {
-            EntityID entity_ID1 = *it_1;
-           
-            auto& physic1 = ECSM.get_component<Physics_Component>(entity_ID1);
-          
-            
-            // Skip if entity is static
-            if (physic1.get_is_static())
-                continue;
-           
-                
-            auto& transform1 = ECSM.get_component<Transform2D>(entity_ID1);
-            auto& collision1 = ECSM.get_component<Collision_Component>(entity_ID1);
-            auto& velocity1 = ECSM.get_component<Velocity_Component>(entity_ID1);
-            std::cout << "Entity " << entity_ID1 << " Position: (" << transform1.position.x << ", " << transform1.position.y << ")\n";
-            // Create AABB for object 1
-            AABB aabb1 = AABB::from_transform(transform1, collision1);
-           
-            bool is_grounded = false; // Track if entity is grounded
-            
-            auto it_2 = std::next(it_1); // Start from the next entity
-           
-            // Check for collisions with other entities
-            for (auto it_2 = collision_entities.begin(); it_2 != collision_entities.end(); ++it_2) {
-                EntityID entity_ID2 = *it_2;
-                //std::cout << "entity 1 is :" << entity_ID1 << "\n";
-               
-                if (entity_ID1 == entity_ID2)
-                {
-                    continue;
-                }
 
+    bool Collision_System::runs_in_editor() const {
+        return false;
+    }
 
-                //auto& physic2 = ECSM.get_component<Physics_Component>(entity_ID2);
+    void Collision_System::set_picking(bool enable) {
+        picking = enable;
+        main_thread_only = enable;
+    }
 
-                auto& transform2 = ECSM.get_component<Transform2D>(entity_ID2);
-                auto& collision2 = ECSM.get_component<Collision_Component>(entity_ID2);
-                auto& velocity2 = ECSM.get_component<Velocity_Component>(entity_ID2);
+    void Collision_System::set_broadphase(Broadphase_Type type) {
+        // Overlap events and trees restart from nothing when switching back to their broadphase
+        if (type != broadphase) {
+            sweep_and_prune.clear();
+            tree_broadphase.clear();
+        }
+        broadphase = type;
+    }
 
-            
-                // Create AABB for object 2
-                AABB aabb2 = AABB::from_transform(transform2, collision2);
-                
+    Broadphase_Type Collision_System::get_broadphase() const {
+        return broadphase;
+    }
 
+    void Collision_System::set_cell_size(float size) {
+        spatial_hash.set_cell_size(size);
+    }
 
-                // Check for intersection between two entities
-                float collision_time = delta_time;
-                if (collision_intersection_rect_rect(aabb1, velocity1.velocity, aabb2, velocity2.velocity, collision_time, delta_time)) {
-                    //LM.write_log("Player is collide with something checck\n");
-                   
-                    CollisionSide side = compute_collision_side(aabb1, aabb2);
+    std::size_t Collision_System::get_pairs_tested() const {
+        return pairs_tested;
+    }
 
-                    if (side == CollisionSide::BOTTOM)
-                    {
-                        is_grounded = true;
-                        //LM.write_log("is on a platform now ");
-                        //std::cout << "this is collide top\n";
-                        physic1.set_gravity(Vec2D(0.0f, 0.0f));
-                    }
-                  
+    const Sweep_And_Prune& Collision_System::get_sweep_and_prune() const {
+        return sweep_and_prune;
+    }
 
-                    // Store collision pair and overlap information
-                    collisions.push_back({ entity_ID1, entity_ID2, compute_overlap(aabb1, aabb2), side });
-                    //std::cout << "Entity " << entity_ID1 << " collides with Entity " << entity_ID2 << " on side: " << static_cast<int>(side) << "\n";
-                    //std::cout << "Entity " << entity_ID1 << " collides with Entity " << entity_ID2 << " on side: " << static_cast<int>(side) << "\n";
+    const Tree_Broadphase& Collision_System::get_tree_broadphase() const {
+        return tree_broadphase;
+    }
 
-                    //std::cout << "Entity " << entity_ID1 << " Position: (" << transform1.position.x << ", " << transform1.position.y << ")\n";
-                    //std::cout << "Entity " << entity_ID2 << " Position: (" << transform2.position.x << ", " << transform2.position.y << ")\n";
-                    //std::cout << "State of is grouded for player: " << physic1.is_grounded << "\n";
-                    
-#if 1
-                   // std::cout << "Entity " << entity_ID1 << " Position: (" << transform1.position.x << ", " << transform1.position.y << ")\n";
-                    //std::cout << "Entity " << entity_ID2 << " Position: (" << transform2.position.x << ", " << transform2.position.y << ")\n";
-                    //std::cout << "State of is grouded for player: " << physic1.get_is_grounded() << "\n";
-#endif                
-                    
+    void Collision_System::bake_tile_layer() {
+        // Tiles are static colliders that are only drawn, anything else may move them or react
+        ComponentMask tile_components;
+        tile_components.set(ECSM.get_component_id<Transform2D>());
+        tile_components.set(ECSM.get_component_id<Velocity_Component>());
+        tile_components.set(ECSM.get_component_id<Collision_Component>());
+        tile_components.set(ECSM.get_component_id<Physics_Component>());
+        tile_components.set(ECSM.get_component_id<Graphics_Component>());
+        tile_components.set(ECSM.get_component_id<Static_Tag>());
+        tile_components.set(ECSM.get_component_id<Tile_Tag>());
+
+        auto tile_view = ECSM.view<const Transform2D, const Collision_Component>();
+        std::vector<EntityID> tile_entities;
+        std::vector<AABB> tile_boxes;
+        std::vector<EntityID> untagged;
+
+        for (const auto& entity : ECSM.get_entities()) {
+            if (!entity) {
+                continue;
+            }
+            EntityID entity_id = entity->get_id();
+            ComponentMask mask = entity->get_component_mask();
+
+            bool is_tile = (mask & ~tile_components).none() && (mask & signature) == signature &&
+                mask.test(ECSM.get_component_id<Static_Tag>());
+            if (is_tile) {
+                auto [transform, collision] = tile_view.get(entity_id);
+                AABB box = AABB::from_transform(transform, collision);
+                is_tile = std::isfinite(box.min.x) && std::isfinite(box.min.y) &&
+                    std::isfinite(box.max.x) && std::isfinite(box.max.y);
+                if (is_tile) {
+                    tile_entities.push_back(entity_id);
+                    tile_boxes.push_back(box);
                 }
             }
-            physic1.set_is_grounded(is_grounded);
-            if (!is_grounded) {
-                physic1.set_gravity(Vec2D(0.0f, DEFAULT_GRAVITY));
+
+            if (!is_tile && mask.test(ECSM.get_component_id<Tile_Tag>())) {
+                untagged.push_back(entity_id);
             }
         }
-    }
 
-    bool Collision_System::collision_intersection_rect_rect(const AABB& aabb1,
-        const Vec2D& vel1,
-        const AABB& aabb2,
-        const Vec2D& vel2,
-        float& firstTimeOfCollision,
-        float delta_time) {
-        // Check for AABB intersection
-        // Check for AABB intersection
-        //check for A.max < B.min or A.min > B.min for x axis & y axis
-        if (aabb1.max.x < aabb2.min.x || aabb1.min.x > aabb2.max.x ||
-            aabb1.max.y < aabb2.min.y || aabb1.min.y > aabb2.max.y)
-        {
-            return false; //no intersection
+        for (EntityID entity_id : untagged) {
+            ECSM.remove_component<Tile_Tag>(entity_id);
+        }
+        for (EntityID entity_id : tile_entities) {
+            if (!ECSM.has_component<Tile_Tag>(entity_id)) {
+                ECSM.add_component<Tile_Tag>(entity_id, Tile_Tag());
+            }
         }
 
-        float Vb_x = vel2.x - vel1.x;; //initialize Vb for x axis 
-        float Vb_y = vel2.y - vel1.y;; //initialize Vb for y axis
-
-        float dFirst_x = aabb1.max.x - aabb2.min.x;  //initialize for dFirst for x-axis
-        float dFirst_y = aabb1.max.y - aabb2.min.y;; // initialize for dFrist for y axis
-        float dLast_x = aabb1.min.x - aabb2.max.x;; //initialize for dLast for x axis
-        float dLast_y = aabb1.min.y - aabb2.max.y;; //initialize for dLast for y axis
-
-#if 1
+        tile_layer.bake(tile_entities, tile_boxes);
+        tile_bake_tick = ECSM.get_change_tick();
+        LM.write_log("Collision_System::bake_tile_layer(): Baked %zu static colliders into the tile layer.", tile_entities.size());
+    }
 
-        float tFirst = firstTimeOfCollision = 0.0f; //Initialise t first
-        float tLast = delta_time; //initialize tLast and assume 1 as the time step (g_dt)
+    const Tile_Layer& Collision_System::get_tile_layer() const {
+        return tile_layer;
+    }
 
-        //for x-axis
-        if (Vb_x < 0)
-        {
-            //case 1 for x-axis
-            if (aabb1.min.x > aabb2.max.x)
-            {
-                return false;
-            }
-            //case 4 for x-axis
-            if (aabb1.max.x < aabb2.min.x)
-            {
-                if (tFirst < dFirst_x / Vb_x)
-                {
-                    tFirst = dFirst_x / Vb_x;
-                }
-            }
+    void Collision_System::refresh_tile_layer() {
+        auto tile_view = ECSM.view<const Transform2D, const Collision_Component>();
+        const auto& tile_pool = ECSM.get_component_pool<Tile_Tag>();
 
-            if (aabb1.min.x < aabb2.max.x)
-            {
-                if (tLast > dLast_x / Vb_x)
-                {
-                    tLast = dLast_x / Vb_x;
-                }
+        // The editor controls and inspector can move or resize tiles after the bake
+        bool stale = false;
+        for (EntityID tile_ID : tile_layer.get_entities()) {
+            if (!tile_pool.has(tile_ID) || tile_view.changed_since(tile_ID, tile_bake_tick)) {
+                stale = true;
+                break;
             }
         }
-        else if (Vb_x > 0)
-        {
-            //case 2 for x_axis
-            if (aabb1.min.x > aabb2.max.x)
-            {
-                if (tFirst < dLast_x / Vb_x)
-                {
-                    tFirst = dLast_x / Vb_x;
-                }
+        if (!stale) {
+            return;
+        }
+
+        std::vector<EntityID> tile_entities;
+        std::vector<AABB> tile_boxes;
+        for (EntityID tile_ID : tile_layer.get_entities()) {
+            if (!tile_pool.has(tile_ID)) {
+                continue;
             }
-            if (aabb1.max.x > aabb2.min.x)
-            {
-                if (tLast > dFirst_x / Vb_x)
-                {
-                    tLast = dFirst_x / Vb_x;
-                }
+            auto [transform, collision] = tile_view.get(tile_ID);
+            AABB box = AABB::from_transform(transform, collision);
+            if (std::isfinite(box.min.x) && std::isfinite(box.min.y) &&
+                std::isfinite(box.max.x) && std::isfinite(box.max.y)) {
+                tile_entities.push_back(tile_ID);
+                tile_boxes.push_back(box);
             }
+        }
 
-            //case 3
-            if (aabb1.max.x < aabb2.min.x)
-            {
-                return false;
+        tile_layer.bake(tile_entities, tile_boxes);
+        tile_bake_tick = ECSM.get_change_tick();
+    }
+ 
+    void Collision_System::collision_check_collide(std::vector<CollisionPair>& collisions, float delta_time) {
+        // Iterate over entities matching the system's signature
+        const std::vector<EntityID>& collision_entities = get_entities().data();
+        std::uint32_t count = static_cast<std::uint32_t>(collision_entities.size());
+        std::uint32_t since_tick = last_update_tick;
+        last_update_tick = ECSM.get_change_tick();
+
+        // Tiles are tested with their baked boxes, so bring them up to date first
+        refresh_tile_layer();
+
+        // Resolve the component pools once for both loops, only physics is written here
+        auto collision_view = ECSM.view<const Transform2D, const Collision_Component, Physics_Component, const Velocity_Component>();
+        auto box_view = ECSM.view<const Transform2D, const Collision_Component>();
+        auto& physics_pool = ECSM.get_component_pool<Physics_Component>();
+        const auto& velocity_pool = ECSM.get_component_pool<Velocity_Component>();
+
+        // Create the AABB of every entity once, reading physics without stamping it
+        boxes.clear();
+        boxes.reserve(count);
+        is_static.assign(count, false);
+        bool statics_moved = false;
+        for (std::uint32_t index = 0; index < count; ++index) {
+            EntityID entity_ID = collision_entities[index];
+            auto [transform, collision] = box_view.get(entity_ID);
+            boxes.push_back(AABB::from_transform(transform, collision));
+            if (physics_pool.read(entity_ID).get_is_static()) {
+                is_static[index] = true;
+                statics_moved = statics_moved || box_view.changed_since(entity_ID, since_tick);
             }
+        }
 
+        // Find the pairs that may collide
+        switch (broadphase) {
+        case Broadphase_Type::SPATIAL_HASH:
+            spatial_hash.find_pairs(boxes, candidate_pairs);
+            break;
+        case Broadphase_Type::SWEEP_AND_PRUNE:
+            sweep_and_prune.find_pairs(collision_entities, boxes, candidate_pairs);
+            break;
+        case Broadphase_Type::AABB_TREE:
+            tree_broadphase.find_pairs(collision_entities, boxes, is_static, statics_moved, candidate_pairs);
+            break;
+        default:
+            find_pairs_brute_force(boxes, candidate_pairs);
+            break;
         }
-        else if (Vb_x == 0) {
-            //case 5;
-            if (aabb1.max.x < aabb2.min.x)
-            {
-                return false;
+
+        // Test each pair from the side of every non-static entity in it, grouped by that entity
+        // and in entity list order, as when every entity was tested against every other
+        directed_pairs.clear();
+        for (const Candidate_Pair& pair : candidate_pairs) {
+            if (!is_static[pair.first]) {
+                directed_pairs.emplace_back(pair.first, pair.second);
             }
-            else if (aabb1.min.x > aabb2.max.x)
-            {
-                return false;
+            if (!is_static[pair.second]) {
+                directed_pairs.emplace_back(pair.second, pair.first);
             }
         }
+        std::sort(directed_pairs.begin(), directed_pairs.end());
+        pairs_tested = directed_pairs.size();
 
-        //for y-axis
-        if (Vb_y < 0)
-        {
-            //case 1 for x-axis
-            if (aabb1.min.y > aabb2.max.y)
-            {
-                return 0;
-            }
-            //case 4 for x-axis
-            if (aabb1.max.y < aabb2.min.y)
-            {
-                if (tFirst < dFirst_y / Vb_y)
-                {
-                    tFirst = dFirst_y / Vb_y;
-                }
+        std::size_t next_pair = 0;
+        for (std::uint32_t index1 = 0; index1 < count; ++index1) {
+            // Skip if entity is static
+            if (is_static[index1])
+                continue;
+
+            EntityID entity_ID1 = collision_entities[index1];
+            auto [transform1, collision1, physic1, velocity1] = collision_view.get(entity_ID1);
+
+            const AABB& aabb1 = boxes[index1];
+            bool is_grounded = false; // Track if entity is grounded
+
+            // Gather the entity's candidates, then the level geometry around it
+            candidate_ids.clear();
+            candidate_colliders.clear();
+            for (; next_pair < directed_pairs.size() && directed_pairs[next_pair].first == index1; ++next_pair) {
+                std::uint32_t index2 = directed_pairs[next_pair].second;
+                EntityID entity_ID2 = collision_entities[index2];
+                candidate_ids.push_back(entity_ID2);
+                candidate_colliders.add(boxes[index2], std::get<3>(collision_view.get(entity_ID2)).velocity);
             }
-            if (aabb1.min.y < aabb2.max.y)
-            {
-                if (tLast > dLast_y / Vb_y)
-                {
-                    tLast = dLast_y / Vb_y;
-                }
+
+            tile_layer.query(aabb1, tile_hits);
+            for (std::uint32_t tile : tile_hits) {
+                EntityID tile_ID = tile_layer.get_entity(tile);
+                candidate_ids.push_back(tile_ID);
+                candidate_colliders.add(tile_layer.get_box(tile), velocity_pool.read(tile_ID).velocity);
+                ++pairs_tested;
             }
-        }
-        else if (Vb_y > 0)
-        {
-            //case 2 for x_axis
-            if (aabb1.min.y > aabb2.max.y)
-            {
-                if (tFirst < dLast_y / Vb_y)
-                {
-                    tFirst = dLast_y / Vb_y;
+
+            // Check for intersection with every candidate at once
+            collision_intersection_batch(aabb1, velocity1.velocity, candidate_colliders, delta_time, candidate_hits, contact_times);
+
+            for (std::size_t candidate = 0; candidate < candidate_ids.size(); ++candidate) {
+                if (!candidate_hits[candidate]) {
+                    continue;
                 }
-            }
-            if (aabb1.max.y > aabb2.min.y)
-            {
-                if (tLast > dFirst_y / Vb_y)
+
+                AABB aabb2(Vec2D(candidate_colliders.min_x[candidate], candidate_colliders.min_y[candidate]),
+                    Vec2D(candidate_colliders.max_x[candidate], candidate_colliders.max_y[candidate]));
+                CollisionSide side = compute_collision_side(aabb1, aabb2);
+
+                if (side == CollisionSide::BOTTOM)
                 {
-                    tLast = dFirst_y / Vb_y;
+                    is_grounded = true;
+                    physic1.set_gravity(Vec2D(0.0f, 0.0f));
                 }
+
+                // Store collision pair and overlap information
+                collisions.push_back({ entity_ID1, candidate_ids[candidate], compute_overlap(aabb1, aabb2), side });
             }
-            //case 3
-            if (aabb1.max.y < aabb2.min.y)
-            {
-                return false;
-            }
-        }
-        else if (Vb_y == 0) {
-            //case 5;
-            if (aabb1.max.y < aabb2.min.y)
-            {
-                return false;
-            }
-            else if (aabb1.min.y > aabb2.max.y)
-            {
-                return false;
+            physic1.set_is_grounded(is_grounded);
+            if (!is_grounded) {
+                physic1.set_gravity(Vec2D(0.0f, DEFAULT_GRAVITY));
             }
         }
-        //case 6; 
-        if (tFirst > tLast)
-        {
-            return false;
-        }
-#endif
-        return true; //the rectangle intersect
+    }
 
+    bool Collision_System::collision_intersection_rect_rect(const AABB& aabb1,
+        const Vec2D& vel1,
+        const AABB& aabb2,
+        const Vec2D& vel2,
+        float& firstTimeOfCollision,
+        float delta_time) {
+        return collision_intersection_pair(aabb1, vel1, aabb2, vel2, firstTimeOfCollision, delta_time);
     }
 
     Vec2D Collision_System::compute_overlap(const AABB& aabb1, const AABB& aabb2) {
@@ -536,7 +546,9 @@ namespace lof {
         collision_check_collide(collisions, delta_time); // Check for collisions and fill the collision list
         //std::cout << "---------------------------this is end of check collide in collision syystem----------------------------------------\n";
         resolve_collision_event(collisions);
-        Check_Selected_Entity();
+        if (picking) {
+            Check_Selected_Entity();
+        }
     
 #if 0
     if (entitySelected) {
@@ -565,10 +577,21 @@ namespace lof {
         bool entitySelected = false;
         EntityID selectedEntityID = -1;
 
-        for (EntityID entityID : get_entities())
+        // Read-only view so picking does not mark every transform as changed
+        auto selection_view = ECSM.view<const Transform2D, const Collision_Component>();
+        const auto& tile_pool = ECSM.get_component_pool<Tile_Tag>();
+
+        // Level geometry in the tile layer can be picked as well
+        std::vector<EntityID> pickable(get_entities().data());
+        for (EntityID tile_ID : tile_layer.get_entities()) {
+            if (tile_pool.has(tile_ID)) {
+                pickable.push_back(tile_ID);
+            }
+        }
+
+        for (EntityID entityID : pickable)
         {
-            auto& transform = ECSM.get_component<Transform2D>(entityID);
-            auto& collision = ECSM.get_component<Collision_Component>(entityID);
+            auto [transform, collision] = selection_view.get(entityID);
 
             float entityX = transform.position.x;
             float entityY = transform.position.y;
@@ -18,6 +18,10 @@
 #include "../Component/Component.h"
 #include "../Manager/ECS_Manager.h"
 #include "System.h"
+#include "AABB.h"
+#include "Broadphase.h"
+#include "Collision_Batch.h"
+#include "Tile_Layer.h"
 
 //include standard header
 #include <iostream>
@@ -52,30 +56,6 @@ namespace lof {
         bool is_grounded;
     };
 
-    /**
-     * @struct AABB
-     * @brief Represents axis-aligned bounding boxes for collision detection.
-     */
-    struct AABB {
-        Vec2D min; ///< Minimum point of the bounding box
-        Vec2D max; ///< Maximum point of the bounding box
-
-        /**
-         * @brief Constructor to initialize minimum and maximum points of AABB.
-         * @param min Minimum corner of the bounding box.
-         * @param max Maximum corner of the bounding box.
-         */
-        AABB(const Vec2D& min, const Vec2D& max);
-
-        /**
-         * @brief Create AABB from Transform2D and Collision_Component.
-         * @param transform Transform component data including position, rotation, scale.
-         * @param collision Collision component data including width and height.
-         * @return AABB instance.
-         */
-        static AABB from_transform(const Transform2D& transform, const Collision_Component& collision);
-    };
-
 
    // extern SelectedEntityInfo g_selected_Entity_Info;
     /**
@@ -108,17 +88,90 @@ namespace lof {
          */
         std::string get_type() const override;
 
+        /**
+         * @brief Collision is paused while the level editor is active.
+         * @return false.
+         */
+        bool runs_in_editor() const override;
+
+        /**
+         * @brief Enable or disable picking the entity under the mouse cursor after each update.
+         * @details Picking reads the cursor through GLFW, so the system stays on the main thread
+         *          while it is enabled. Worlds without rendering disable it.
+         * @param enable True to pick entities with the mouse, false to only resolve collisions.
+         */
+        void set_picking(bool enable);
+
+        /**
+         * @brief Choose how candidate collision pairs are found.
+         * @param type The broadphase to use from the next update.
+         */
+        void set_broadphase(Broadphase_Type type);
+
+        /**
+         * @brief Get the broadphase in use.
+         * @return The broadphase type.
+         */
+        Broadphase_Type get_broadphase() const;
+
+        /**
+         * @brief Set the cell size of the spatial hash broadphase.
+         * @param size Width and height of a cell in world units, ignored if not positive.
+         */
+        void set_cell_size(float size);
+
+        /**
+         * @brief Get the number of narrowphase tests run in the last update.
+         * @details A pair with two moving entities is tested once from each side.
+         * @return The number of pairs tested.
+         */
+        std::size_t get_pairs_tested() const;
+
+        /**
+         * @brief Get the sweep-and-prune broadphase, for its overlap events.
+         * @details Its overlaps and events are only updated while it is the broadphase in use.
+         * @return Const reference to the sweep-and-prune broadphase.
+         */
+        const Sweep_And_Prune& get_sweep_and_prune() const;
+
+        /**
+         * @brief Get the AABB tree broadphase, for box and ray queries against its trees.
+         * @details Its trees are only updated while it is the broadphase in use.
+         * @return Const reference to the AABB tree broadphase.
+         */
+        const Tree_Broadphase& get_tree_broadphase() const;
+
+        /**
+         * @brief Bake the static level geometry into the tile layer.
+         * @details Static colliders with no behaviour beyond rendering are tagged with Tile_Tag, which
+         *          takes them out of the entity list, and their boxes are baked into the tile layer.
+         *          Tagged entities that no longer qualify lose the tag. Tiles moved or resized after
+         *          the bake are picked up by the next update, which rebakes the layer with their new
+         *          boxes, but tiles only join or leave the layer here. Adds and removes components,
+         *          so it must not run during a system update.
+         */
+        void bake_tile_layer();
+
+        /**
+         * @brief Get the tile layer, for occupancy queries against the level geometry.
+         * @return Const reference to the tile layer.
+         */
+        const Tile_Layer& get_tile_layer() const;
+
         //int Check_Instance_Collision(float pos_x, float pos_y, float scale_x, float scale_y);
 
         CollisionSide compute_collision_side(const AABB& aabb1, const AABB& aabb2);
 
         /**
          * @brief Check for intersection between rectangles.
+         * @details Forwards to collision_intersection_pair(). The update tests candidates with
+         *          collision_intersection_batch(), which gives the same results several pairs at a time.
          * @param aabb1 First AABB.
          * @param vel1 First velocity.
          * @param aabb2 Second AABB.
          * @param vel2 Second velocity.
-         * @param firstTimeOfCollision Output param to hold the time of collision.
+         * @param firstTimeOfCollision Output param to hold the time of first contact, if they intersect.
+         * @param delta_time The length of the time step.
          * @return True if rectangles intersect, false otherwise.
          */
         bool collision_intersection_rect_rect(const AABB& aabb1,
@@ -140,9 +193,36 @@ namespace lof {
 
         static std::once_flag once_flag;
 
+        bool picking = true; ///< True if update() picks the entity under the mouse cursor
+
+        Broadphase_Type broadphase = Broadphase_Type::SPATIAL_HASH; ///< Method used to find candidate pairs
+        Spatial_Hash spatial_hash;                                  ///< Grid for the spatial hash broadphase
+        Sweep_And_Prune sweep_and_prune;                            ///< Sorted endpoints for the sweep-and-prune broadphase
+        Tree_Broadphase tree_broadphase;                            ///< Trees for the AABB tree broadphase
+        Tile_Layer tile_layer;                                      ///< Boxes of the static level geometry
+        std::vector<std::uint32_t> tile_hits;                       ///< Tiles near the entity being tested
+        std::uint32_t tile_bake_tick = 0;                           ///< Change tick when the tile layer was last baked
+        std::vector<EntityID> candidate_ids;                        ///< Candidates of the entity being tested
+        Collider_Arrays candidate_colliders;                        ///< Boxes and velocities of the candidates
+        std::vector<std::uint8_t> candidate_hits;                   ///< Whether each candidate intersects
+        std::vector<float> contact_times;                           ///< Time of first contact with each candidate
+        std::vector<AABB> boxes;                                    ///< Box of each entity, in entity list order
+        std::vector<bool> is_static;                                ///< Whether each entity is static, in entity list order
+        std::vector<Candidate_Pair> candidate_pairs;                ///< Pairs from the broadphase
+        std::vector<Candidate_Pair> directed_pairs;                 ///< Candidate pairs seen from each moving entity
+        std::size_t pairs_tested = 0;                               ///< Narrowphase tests in the last update
+        std::uint32_t last_update_tick = 0;                         ///< Change tick at the start of the last update
+
         
         //sstd::vector<CollisionPair> collision_pairs; // Store collisions
 
+        /**
+         * @brief Rebake the tile layer if a tile was destroyed, moved or resized since the last bake.
+         * @details Keeps the tile set, so no components are added or removed and it is safe during
+         *          an update. Tiles that were destroyed or whose box is no longer finite are left out.
+         */
+        void refresh_tile_layer();
+
         /**
          * @brief Compute the overlap between AABBs.
          * @param aabb1 First AABB object.
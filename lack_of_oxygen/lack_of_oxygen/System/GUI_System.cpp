@@ -31,6 +31,9 @@ namespace lof {
         signature.set(ecs_manager.get_component_id<Transform2D>());
         signature.set(ecs_manager.get_component_id<Graphics_Component>());
         signature.set(ecs_manager.get_component_id<GUI_Component>());
+
+        // Set the components accessed during update
+        read_signature.set(ecs_manager.get_component_id<GUI_Component>());
     }
 
     void GUI_System::show_loading_screen() {
@@ -106,6 +109,13 @@ namespace lof {
                 }
                 LM.write_log("Progress bar created with stored value: %.2f", last_progress_value);
             }
+
+            // Positions above are relative to the container
+            for (EntityID child : { left_image_id, right_image_id, background_bar_id, progress_bar_id }) {
+                if (child != INVALID_ENTITY_ID) {
+                    ecs_manager.set_parent(child, container_id);
+                }
+            }
         }
     }
 
@@ -158,71 +168,16 @@ namespace lof {
         if (left_image_id != INVALID_ENTITY_ID) entities_to_destroy.push_back({ left_image_id, "Left Image" });
         if (container_id != INVALID_ENTITY_ID) entities_to_destroy.push_back({ container_id, "Container" });
 
-        // Destroy each entity with extra validation
+        // Record the destruction, the entities leave the ECS and this system at the next sync point
+        Entity_Command_Buffer& commands = ecs_manager.get_command_buffer();
         for (const auto& [id, name] : entities_to_destroy) {
-            LM.write_log("Attempting to destroy %s (ID: %u)", name, id);
-
-            bool was_in_system = false;
-            bool was_in_ecs = false;
-
-            // Check initial state
-            if (entities.find(id) != entities.end()) {
-                was_in_system = true;
-                LM.write_log("%s found in GUI system", name);
-            }
-
-            if (auto* entity = ecs_manager.get_entity(id)) {
-                was_in_ecs = true;
-                LM.write_log("%s found in ECS", name);
-
-                // First reset any accumulated state for progress bar
-                if (id == progress_bar_id &&
-                    ecs_manager.has_component<GUI_Component>(id) &&
-                    ecs_manager.has_component<Transform2D>(id)) {
-                    auto& gui = ecs_manager.get_component<GUI_Component>(id);
-                    auto& transform = ecs_manager.get_component<Transform2D>(id);
-                    gui.progress = 0.0f;
-                    transform.scale.x = 0.0f;
-                    LM.write_log("Reset progress bar state before destruction");
-                }
-
-                // MUST Remove from this system first 
-                if (was_in_system) {
-                    remove_entity(id);
-                    LM.write_log("%s removed from GUI system", name);
-
-                    // Validate removal from system
-                    if (entities.find(id) == entities.end()) {
-                        LM.write_log("%s successfully removed from GUI system", name);
-                    }
-                    else {
-                        LM.write_log("WARNING: %s still in GUI system after removal attempt", name);
-                    }
-                }
-
-                // Then destroy in ECS
-                LM.write_log("Calling destroy_entity on %s (ID: %u)", name, id);
-                ecs_manager.destroy_entity(id);
-
-                // Validate destruction
-                if (ecs_manager.get_entity(id) == nullptr) {
-                    LM.write_log("%s successfully destroyed in ECS", name);
-                }
-                else {
-                    LM.write_log("WARNING: %s still exists in ECS after destruction attempt", name);
-                }
+            if (ecs_manager.get_entity(id)) {
+                LM.write_log("Recording destroy_entity on %s (ID: %u)", name, id);
+                commands.destroy_entity(id);
             }
             else {
                 LM.write_log("Warning: %s (ID: %u) not found in ECS", name, id);
             }
-
-            // Final validation for this entity
-            if (was_in_system && entities.find(id) != entities.end()) {
-                LM.write_log("ERROR: Failed to remove %s from GUI system", name);
-            }
-            if (was_in_ecs && ecs_manager.get_entity(id) != nullptr) {
-                LM.write_log("ERROR: Failed to destroy %s in ECS", name);
-            }
         }
 
         // Reset IDs
@@ -232,25 +187,7 @@ namespace lof {
         left_image_id = INVALID_ENTITY_ID;
         container_id = INVALID_ENTITY_ID;
 
-        // Final validation
-        validate_gui_state();
-
-        // Specific check for background bar
-        if (auto* entity = ecs_manager.get_entity(background_bar_id)) {
-            LM.write_log("ERROR: Background bar still exists after cleanup!");
-            debug_entity("Lingering Background Bar", background_bar_id);
-        }
-
-        LM.write_log("=== GUI cleanup completed ===");
-
-        // Double check system state
-        const auto& remaining_entities = get_entities();
-        if (!remaining_entities.empty()) {
-            LM.write_log("WARNING: %zu entities still in GUI system after cleanup", remaining_entities.size());
-            for (EntityID id : remaining_entities) {
-                debug_entity("Remaining", id);
-            }
-        }
+        LM.write_log("=== GUI cleanup recorded ===");
     }
 
     void GUI_System::set_progress(float progress) {
@@ -273,31 +210,9 @@ namespace lof {
     }
 
     void GUI_System::update(float delta_time) {
-        auto* container_transform = get_component_safe<Transform2D>(container_id);
-        if (!container_transform) return;
+        (void)delta_time;
 
-        Vec2D container_pos = container_transform->position;
-
-        // Update circular images positions (on top)
-        if (auto* left_transform = get_component_safe<Transform2D>(left_image_id)) {
-            left_transform->position = container_pos + Vec2D(-DEFAULT_GUI_IMAGE_OFFSET, DEFAULT_GUI_VERTICAL_SPACING);
-        }
-
-        if (auto* right_transform = get_component_safe<Transform2D>(right_image_id)) {
-            right_transform->position = container_pos + Vec2D(DEFAULT_GUI_IMAGE_OFFSET, DEFAULT_GUI_VERTICAL_SPACING);
-        }
-
-        // Update background bar position (below images)
-        if (auto* bg_transform = get_component_safe<Transform2D>(background_bar_id)) {
-            bg_transform->position = container_pos + Vec2D(0.0f, -DEFAULT_GUI_VERTICAL_SPACING);
-        }
-
-        // Update progress bar position
-        if (auto* progress_transform = get_component_safe<Transform2D>(progress_bar_id)) {
-            // Keep X position for progress animation, update Y position only
-            float current_x = progress_transform->position.x;
-            progress_transform->position = Vec2D(current_x, container_pos.y - DEFAULT_GUI_VERTICAL_SPACING);
-        }
+        // Child elements are attached to the container, so the Hierarchy_System moves them with it
     }
 
     void GUI_System::debug_entity(const char* prefix, EntityID id) {
@@ -321,7 +236,7 @@ namespace lof {
 
         if (ecs_manager.has_component<Graphics_Component>(id)) {
             auto& graphics = ecs_manager.get_component<Graphics_Component>(id);
-            LM.write_log("  - Graphics: texture='%s'", graphics.texture_name.c_str());
+            LM.write_log("  - Graphics: texture='%s'", graphics.texture_name->c_str());
         }
 
         if (ecs_manager.has_component<GUI_Component>(id)) {
@@ -331,7 +246,7 @@ namespace lof {
         }
 
         // Check if entity is in this system
-        if (entities.find(id) != entities.end()) {
+        if (entities.contains(id)) {
             LM.write_log("  - Present in GUI_System");
         }
         else {
@@ -94,6 +94,8 @@ namespace lof {
 
         /**
          * @brief Hides and cleans up the loading screen GUI elements.
+         * @details The elements are destroyed through the ECS_Manager's command buffer, so they
+         *          remain until its next sync point.
          */
         void hide_loading_screen();
 
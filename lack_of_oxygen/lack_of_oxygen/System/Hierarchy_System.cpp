@@ -0,0 +1,90 @@
+/**
+ * @file Hierarchy_System.cpp
+ * @brief Implements the Hierarchy_System class for propagating transforms from parents to children.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Hierarchy_System.h"
+
+namespace lof {
+
+    Hierarchy_System::Hierarchy_System() {
+        // Set the required components for this system
+        signature.set(ECSM.get_component_id<Transform2D>());
+        signature.set(ECSM.get_component_id<Hierarchy_Component>());
+
+        // Set the components accessed during update
+        read_signature.set(ECSM.get_component_id<Transform2D>());
+        write_signature.set(ECSM.get_component_id<Hierarchy_Component>());
+    }
+
+    void Hierarchy_System::update(float delta_time) {
+        (void)delta_time;
+
+        std::uint32_t since_tick = last_update_tick;
+        last_update_tick = ECSM.get_change_tick();
+
+        auto& hierarchy_pool = ECSM.get_component_pool<Hierarchy_Component>();
+        const auto& transform_pool = ECSM.get_component_pool<Transform2D>();
+
+        for (EntityID root : get_entities()) {
+
+            // Start a walk at every root, an entity whose parent is not part of this system
+            EntityID parent = hierarchy_pool.read(root).parent;
+            if (parent != INVALID_ENTITY_ID && entities.contains(parent)) {
+                continue;
+            }
+
+            pending.push_back({ root, glm::mat3(1.0f), false });
+            while (!pending.empty()) {
+                Visit visit = pending.back();
+                pending.pop_back();
+
+                const Hierarchy_Component& node = hierarchy_pool.read(visit.entity);
+                bool changed = visit.parent_changed ||
+                    transform_pool.changed_since(visit.entity, since_tick) ||
+                    hierarchy_pool.changed_since(visit.entity, since_tick);
+
+                if (changed) {
+                    const Transform2D& transform = transform_pool.read(visit.entity);
+
+                    // Compute object rotational matrix
+                    GLfloat rad_disp = glm::radians(transform.orientation.x);
+                    glm::mat3 rot_mat{ glm::cos(rad_disp),  glm::sin(rad_disp), 0,
+                                        -glm::sin(rad_disp),  glm::cos(rad_disp), 0,
+                                        0,                   0,                  1 };
+
+                    // Compute object translation matrix
+                    glm::mat3 trans_mat{ 1, 0, 0,
+                                            0, 1, 0,
+                                            transform.position.x, transform.position.y, 1 };
+
+                    // Compute object scale matrix, which is not passed on to children
+                    glm::mat3 scale_mat{ transform.scale.x, 0, 0,
+                                            0, transform.scale.y, 0,
+                                            0, 0, 1 };
+
+                    Hierarchy_Component& updated = hierarchy_pool.get(visit.entity);
+                    updated.node_xform = visit.parent_xform * trans_mat * rot_mat;
+                    updated.world_xform = updated.node_xform * scale_mat;
+                }
+
+                for (EntityID child = node.first_child; child != INVALID_ENTITY_ID; child = hierarchy_pool.read(child).next_sibling) {
+                    if (entities.contains(child)) {
+                        pending.push_back({ child, node.node_xform, changed });
+                    }
+                }
+            }
+        }
+    }
+
+    std::string Hierarchy_System::get_type() const {
+        return "Hierarchy_System";
+    }
+
+} // namespace lof
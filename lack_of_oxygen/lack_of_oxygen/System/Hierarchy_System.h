@@ -0,0 +1,70 @@
+/**
+ * @file Hierarchy_System.h
+ * @brief Defines the Hierarchy_System class for propagating transforms from parents to children.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_HIERARCHY_SYSTEM_H
+#define LOF_HIERARCHY_SYSTEM_H
+
+// Include base system header
+#include "System.h"
+
+// Include other necessary headers
+#include "../Manager/ECS_Manager.h"
+#include "../Component/Component.h"
+
+// Include standard headers
+#include <vector>
+
+namespace lof {
+
+    /**
+     * @class Hierarchy_System
+     * @brief Computes the cached world transforms of entities linked with a Hierarchy_Component.
+     * @details Each tree is walked from its root, so every parent is updated before its children.
+     *          Only entities whose Transform2D or links changed since the last update, and the
+     *          subtrees below them, are recomputed.
+     */
+    class Hierarchy_System : public System {
+    private:
+        /**
+         * @struct Visit
+         * @brief A pending entity in the tree walk and the state inherited from its parent.
+         */
+        struct Visit {
+            EntityID entity;           ///< Entity to update
+            glm::mat3 parent_xform;    ///< Parent's node transform, identity for a root
+            bool parent_changed;       ///< True if the parent's transform was recomputed
+        };
+
+        std::uint32_t last_update_tick = 0; ///< Change tick at the start of the last update
+        std::vector<Visit> pending;         ///< Tree walk stack, kept to avoid reallocating every frame
+
+    public:
+        /**
+         * @brief Constructor for Hierarchy_System.
+         * Initializes the system's signature.
+         */
+        Hierarchy_System();
+
+        /**
+         * @brief Recompute the world transforms of changed entities and their descendants.
+         * @param delta_time The time elapsed since the last update.
+         */
+        void update(float delta_time) override;
+
+        /**
+         * @brief Returns the system's type as a string.
+         * @return The string "Hierarchy_System".
+         */
+        std::string get_type() const override;
+    };
+
+} // namespace lof
+
+#endif // LOF_HIERARCHY_SYSTEM_H
@@ -21,6 +21,10 @@ namespace lof {
     Logic_System::Logic_System() {
         signature.set(ECSM.get_component_id<Logic_Component>());
         signature.set(ECSM.get_component_id<Transform2D>());
+
+        // Set the components accessed during update
+        write_signature.set(ECSM.get_component_id<Logic_Component>());
+        write_signature.set(ECSM.get_component_id<Transform2D>());
     }
 
     std::string Logic_System::get_type() const {
@@ -28,8 +32,6 @@ namespace lof {
     }
 
     void Logic_System::update(float delta_time) {
-        static bool first_frame = true;
-
         for (EntityID entity_id : get_entities()) {
             auto& logic = ECSM.get_component<Logic_Component>(entity_id);
             auto& transform = ECSM.get_component<Transform2D>(entity_id);
@@ -58,7 +60,6 @@ namespace lof {
                 logic.timer += delta_time;
 
                 // Debug every second
-                static float debug_timer = 0.0f;
                 debug_timer += delta_time;
                 if (debug_timer >= 1.0f) {
                     LM.write_log("Entity [%d] '%s' - Pattern: %d, Timer: %.2f, Pos: (%.2f, %.2f)",
@@ -112,12 +113,11 @@ namespace lof {
         float t = logic.movement_speed * logic.timer;
 
         // Debug the circular motion parameters
-        static float debug_timer = 0.0f;
-        debug_timer += delta_time;
-        if (debug_timer >= 1.0f) {
+        circular_debug_timer += delta_time;
+        if (circular_debug_timer >= 1.0f) {
             LM.write_log("Circular Movement - Time: %.2f, Origin: (%.2f, %.2f)",
                 t, logic.origin_pos.x, logic.origin_pos.y);
-            debug_timer = 0.0f;
+            circular_debug_timer = 0.0f;
         }
 
         // Calculate new position using parametric equations of a circle
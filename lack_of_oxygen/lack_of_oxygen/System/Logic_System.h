@@ -35,6 +35,10 @@ namespace lof {
         void update(float delta_time) override;
 
     private:
+        bool first_frame = true;            ///< True until the first update has logged every entity
+        float debug_timer = 0.0f;           ///< Seconds since the entity state was last logged
+        float circular_debug_timer = 0.0f;  ///< Seconds since the circular motion was last logged
+
         /**
          * @brief Updates linear movement for a given entity.
          * @param logic The Logic_Component containing movement parameters.
@@ -15,6 +15,7 @@
 #include "../Manager/ECS_Manager.h"
 #include "../Component/Component.h"
 #include "../Manager/Input_Manager.h"
+#include "../Manager/Job_Manager.h"
 #include "../System/Render_System.h"
 #include "Collision_System.h"
 
@@ -31,6 +32,18 @@ namespace lof {
         signature.set(ECSM.get_component_id<Transform2D>());
         signature.set(ECSM.get_component_id<Velocity_Component>());
         signature.set(ECSM.get_component_id<Physics_Component>());
+
+        // Static entities never move, so keep them out of the entity list
+        exclude_signature.set(ECSM.get_component_id<Static_Tag>());
+
+        // Entities are integrated independently, so they can be visited in spatial order
+        spatially_ordered = true;
+
+        // Set the components accessed during update
+        write_signature.set(ECSM.get_component_id<Transform2D>());
+        write_signature.set(ECSM.get_component_id<Velocity_Component>());
+        write_signature.set(ECSM.get_component_id<Physics_Component>());
+        write_signature.set(ECSM.get_component_id<Audio_Component>());
     }
     /**
      * @brief Integrates physics calculations for movement, applying forces and updating positions.
@@ -42,16 +55,14 @@ namespace lof {
 
         LM.write_log("Movement system start update");
 
-        for (EntityID entity_id : get_entities()) {
-            // std::cout << entity_id << "in physic \n\n";
+        // Resolve the pools here, workers running the chunks are not bound to this ECS_Manager
+        auto movement_view = ECSM.view<Transform2D, Velocity_Component, Physics_Component>();
+        auto& audio_pool = ECSM.get_component_pool<Audio_Component>();
 
-            auto& transform = ECSM.get_component<Transform2D>(entity_id);
-            auto& velocity = ECSM.get_component<Velocity_Component>(entity_id);
-            auto& physics = ECSM.get_component<Physics_Component>(entity_id);
+        auto integrate_entity = [delta_time, &movement_view, &audio_pool](EntityID entity_id) {
+            // std::cout << entity_id << "in physic \n\n";
 
-            // Skip processing for static entities
-            if (physics.get_is_static())
-                continue;
+            auto [transform, velocity, physics] = movement_view.get(entity_id);
 
             // Store the current position before updating
             transform.prev_position = transform.position;
@@ -71,7 +82,7 @@ namespace lof {
                 physics.reset_jump_request();
                 physics.force_helper.deactivate_force(JUMP_UP);  // Deactivate the jump force
 
-                ECSM.get_component<Audio_Component>(entity_id).set_audio_state("jumping", PLAYING);
+                audio_pool.get(entity_id).set_audio_state("jumping", PLAYING);
             }
 
             //update forces based on time
@@ -116,6 +127,21 @@ namespace lof {
 
             // Reset the accumulated force
             physics.reset_forces();
+        };
+
+        // Each entity only touches its own components, so chunks of the entity list can run concurrently
+        if (is_parallel()) {
+            const auto& entity_list = get_entities().data();
+            JM.parallel_for(entity_list.size(), DEFAULT_PARALLEL_GRAIN, [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    integrate_entity(entity_list[i]);
+                }
+            });
+        }
+        else {
+            for (EntityID entity_id : get_entities()) {
+                integrate_entity(entity_id);
+            }
         }
 
     }
@@ -145,6 +171,10 @@ namespace lof {
         return "Movement_System";
     }
 
+    bool Movement_System::runs_in_editor() const {
+        return false;
+    }
+
 } // namespace lof
 
 
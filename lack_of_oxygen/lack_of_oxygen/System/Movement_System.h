@@ -44,6 +44,12 @@ namespace lof {
          */
         std::string get_type() const override;
 
+        /**
+         * @brief Movement is paused while the level editor is active.
+         * @return false.
+         */
+        bool runs_in_editor() const override;
+
     private:
         /**
          * @brief Integrates physics calculations for movement, applying forces and updating positions.
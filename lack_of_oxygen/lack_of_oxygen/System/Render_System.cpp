@@ -14,6 +14,7 @@
  // Include header file
 #include "Render_System.h"
 #include "../Manager/ECS_Manager.h"
+#include "../Manager/Job_Manager.h"
 #include "../Component/Component.h"
 
 
@@ -26,6 +27,25 @@ namespace lof {
         // Set the required components for this system
         signature.set(ECSM.get_component_id<Graphics_Component>());
         signature.set(ECSM.get_component_id<Transform2D>());
+
+        // Set the components accessed during update, drawing requires the OpenGL context on the main thread
+        read_signature.set(ECSM.get_component_id<Velocity_Component>());
+        read_signature.set(ECSM.get_component_id<Text_Component>());
+        read_signature.set(ECSM.get_component_id<Animation_Component>());
+        read_signature.set(ECSM.get_component_id<Hierarchy_Component>());
+        read_signature.set(ECSM.get_component_id<Player_Tag>());
+        read_signature.set(ECSM.get_component_id<Background_Tag>());
+        read_resources.set(RESOURCE_ANIMATION_STORAGE);
+        write_signature.set(ECSM.get_component_id<Graphics_Component>());
+        write_signature.set(ECSM.get_component_id<Transform2D>());
+        write_signature.set(ECSM.get_component_id<Collision_Component>());
+        main_thread_only = true;
+
+        // Text is drawn apart from the sprites
+        Signature text_signature;
+        text_signature.set(ECSM.get_component_id<Text_Component>());
+        sprite_group = add_group(Signature(), text_signature);
+        text_group = add_group(text_signature);
     }
 
     std::string Render_System::get_type() const {
@@ -39,124 +59,179 @@ namespace lof {
         GLfloat screen_width = static_cast<GLfloat>(SM.get_scr_width());
         GLfloat screen_height = static_cast<GLfloat>(SM.get_scr_height());
 
-        // Loop over the entities that match the system's signature
-        for (EntityID entity_id : get_entities()) {
+        // Access player's ID
+        EntityID player_id = ECSM.get_singleton<Player_Tag>();
 
-            auto& graphics = ECSM.get_component<Graphics_Component>(entity_id);
-            auto& transform = ECSM.get_component<Transform2D>(entity_id);
+        // Entities whose transform or graphics changed after the last update need their matrices rebuilt
+        std::uint32_t since_tick = last_update_tick;
+        last_update_tick = ECSM.get_change_tick();
 
-            // Access player's ID
-            EntityID player_id = ECSM.find_entity_by_name(DEFAULT_PLAYER_NAME);
+        // Apply the editor scale and rotation controls in order, since they log per entity
+        bool controls_held = GFXM.get_scale_flag() == GLFW_KEY_UP || GFXM.get_scale_flag() == GLFW_KEY_DOWN ||
+            GFXM.get_rotation_flag() == GLFW_KEY_LEFT || GFXM.get_rotation_flag() == GLFW_KEY_RIGHT;
+        auto render_view = ECSM.view<Graphics_Component, Transform2D>();
+        if (controls_held) {
+            const auto& background_pool = ECSM.get_component_pool<Background_Tag>();
+            for (EntityID entity_id : get_entities()) {
 
-            if (entity_id != 0) { // Background object unaffected
+                Transform2D& transform = std::get<Transform2D&>(render_view.get(entity_id));
 
-                // Scaling update when up or down arrow key pressed
-                GLfloat scale_change = DEFAULT_SCALE_CHANGE * static_cast<GLfloat>(delta_time);
+                if (!background_pool.has(entity_id)) { // Background object unaffected
 
-                // Check if the entity has Collision_Component
-                if (ECSM.has_component<Collision_Component>(entity_id)) {
+                    // Scaling update when up or down arrow key pressed
+                    GLfloat scale_change = DEFAULT_SCALE_CHANGE * static_cast<GLfloat>(delta_time);
 
-                    auto& collision = ECSM.get_component<Collision_Component>(entity_id);
+                    // Check if the entity has Collision_Component
+                    if (ECSM.has_component<Collision_Component>(entity_id)) {
 
-                    int scale_flag = GFXM.get_scale_flag();
-                    if (scale_flag == GLFW_KEY_UP) {
-                        LM.write_log("Render_System::update(): 'UP' key held, increasing scale of entity %u by %f.", entity_id, scale_change);
-                        transform.scale.x += scale_change;
-                        transform.scale.y += scale_change;
-                        collision.width += scale_change;
-                        collision.height += scale_change;
-                    }
-                    else if (scale_flag == GLFW_KEY_DOWN) {
-                        LM.write_log("Render_System::update(): 'DOWN' key held, decreasing scale of entity %u by %f.", entity_id, scale_change);
-                        if (transform.scale.x > 0.0f) {
-                            transform.scale.x -= scale_change;
-                            collision.width -= scale_change;
+                        auto& collision = ECSM.get_component<Collision_Component>(entity_id);
+
+                        int scale_flag = GFXM.get_scale_flag();
+                        if (scale_flag == GLFW_KEY_UP) {
+                            LM.write_log("Render_System::update(): 'UP' key held, increasing scale of entity %u by %f.", entity_id, scale_change);
+                            transform.scale.x += scale_change;
+                            transform.scale.y += scale_change;
+                            collision.width += scale_change;
+                            collision.height += scale_change;
                         }
-                        else {
-                            transform.scale.x = 0.0f;
-                            collision.width = 0.0f;
+                        else if (scale_flag == GLFW_KEY_DOWN) {
+                            LM.write_log("Render_System::update(): 'DOWN' key held, decreasing scale of entity %u by %f.", entity_id, scale_change);
+                            if (transform.scale.x > 0.0f) {
+                                transform.scale.x -= scale_change;
+                                collision.width -= scale_change;
+                            }
+                            else {
+                                transform.scale.x = 0.0f;
+                                collision.width = 0.0f;
+                            }
+
+                            if (transform.scale.y > 0.0f) {
+                                transform.scale.y -= scale_change;
+                                collision.height -= scale_change;
+                            }
+                            else {
+                                transform.scale.y = 0.0f;
+                                collision.height = 0.0f;
+                            }
                         }
 
-                        if (transform.scale.y > 0.0f) {
-                            transform.scale.y -= scale_change;
-                            collision.height -= scale_change;
+                        // Rotation update when left or right arrow key pressed
+                        int rotation_flag = GFXM.get_rotation_flag();
+                        if (rotation_flag == GLFW_KEY_LEFT) {
+                            GLfloat rot_change = transform.orientation.y * static_cast<GLfloat>(delta_time);
+                            transform.orientation.x += rot_change;
+                            LM.write_log("Render_System::update(): 'LEFT' key held, rotating entity %u by %f.", entity_id, rot_change);
                         }
-                        else {
-                            transform.scale.y = 0.0f;
-                            collision.height = 0.0f;
+                        else if (rotation_flag == GLFW_KEY_RIGHT) {
+                            GLfloat rot_change = transform.orientation.y * static_cast<GLfloat>(delta_time);
+                            transform.orientation.x -= rot_change;
+                            LM.write_log("Render_System::update(): 'RIGHT' key held, rotating entity %u by %f.", entity_id, rot_change);
                         }
                     }
 
-                    // Rotation update when left or right arrow key pressed
-                    int rotation_flag = GFXM.get_rotation_flag();
-                    if (rotation_flag == GLFW_KEY_LEFT) {
-                        GLfloat rot_change = transform.orientation.y * static_cast<GLfloat>(delta_time);
-                        transform.orientation.x += rot_change;
-                        LM.write_log("Render_System::update(): 'LEFT' key held, rotating entity %u by %f.", entity_id, rot_change);
-                    }
-                    else if (rotation_flag == GLFW_KEY_RIGHT) {
-                        GLfloat rot_change = transform.orientation.y * static_cast<GLfloat>(delta_time);
-                        transform.orientation.x -= rot_change;
-                        LM.write_log("Render_System::update(): 'RIGHT' key held, rotating entity %u by %f.", entity_id, rot_change);
-                    }
                 }
-
             }
+        }
 
-            // Update camera bounded to player
-            auto& camera = GFXM.get_camera();
+        // Update camera bounded to player
+        auto& camera = GFXM.get_camera();
 
-            if (entity_id == player_id && camera.is_free_cam == GL_FALSE) {
+        if (camera.is_free_cam == GL_FALSE && get_entities().contains(player_id)) {
 
-                // Update world-to-camera view transformation matrix
-                camera.pos_y = transform.position.y;
-                camera.view_xform = glm::mat3{ 1, 0, 0,
-                                               0, 1, 0,
-                                               -1, -transform.position.y, 1 };
+            const Transform2D& transform = ECSM.get_component_pool<Transform2D>().read(player_id);
 
-                // Update window-to-NDC transformation matrix
-                camera.camwin_to_ndc_xform = glm::mat3{ 1.f / (screen_width / 2), 0, 0,
-                                                       0, 1.f / (screen_height / 2), 0,
-                                                       0, 0, 1 };
+            // Update world-to-camera view transformation matrix
+            camera.pos_y = transform.position.y;
+            camera.view_xform = glm::mat3{ 1, 0, 0,
+                                           0, 1, 0,
+                                           -1, -transform.position.y, 1 };
 
-                // Update world-to-NDC transformation matrix
-                camera.world_to_ndc_xform = camera.camwin_to_ndc_xform * camera.view_xform;
-            }
-            else if (camera.is_free_cam == GL_TRUE) {
+            // Update window-to-NDC transformation matrix
+            camera.camwin_to_ndc_xform = glm::mat3{ 1.f / (screen_width / 2), 0, 0,
+                                                   0, 1.f / (screen_height / 2), 0,
+                                                   0, 0, 1 };
+
+            // Update world-to-NDC transformation matrix
+            camera.world_to_ndc_xform = camera.camwin_to_ndc_xform * camera.view_xform;
+        }
+        else if (camera.is_free_cam == GL_TRUE) {
 
-                // Update world-to-camera view transformation matrix
-                camera.view_xform = glm::mat3{ 1, 0, 0,
-                                               0, 1, 0,
-                                               -camera.pos_x, -camera.pos_y, 1 };
+            // Update world-to-camera view transformation matrix
+            camera.view_xform = glm::mat3{ 1, 0, 0,
+                                           0, 1, 0,
+                                           -camera.pos_x, -camera.pos_y, 1 };
 
-                // Update window-to-NDC transformation matrix
-                camera.camwin_to_ndc_xform = glm::mat3{ 1.f / (screen_width / 2), 0, 0,
-                                                       0, 1.f / (screen_height / 2), 0,
-                                                       0, 0, 1 };
+            // Update window-to-NDC transformation matrix
+            camera.camwin_to_ndc_xform = glm::mat3{ 1.f / (screen_width / 2), 0, 0,
+                                                   0, 1.f / (screen_height / 2), 0,
+                                                   0, 0, 1 };
 
-                // Update world-to-NDC transformation matrix
-                camera.world_to_ndc_xform = camera.camwin_to_ndc_xform * camera.view_xform;
+            // Update world-to-NDC transformation matrix
+            camera.world_to_ndc_xform = camera.camwin_to_ndc_xform * camera.view_xform;
+        }
+
+        // Compute the model-to-NDC matrix of each entity, which only writes that entity's Graphics_Component.
+        // The model-to-world matrix is cached, so unchanged entities cost nothing while the camera is still.
+        const glm::mat3 world_to_ndc_xform = camera.world_to_ndc_xform;
+        const bool camera_changed = world_to_ndc_xform != last_world_to_ndc_xform;
+        last_world_to_ndc_xform = world_to_ndc_xform;
+
+        auto xform_view = ECSM.view<Graphics_Component, const Transform2D>();
+        const auto& hierarchy_pool = ECSM.get_component_pool<Hierarchy_Component>();
+        auto compute_xform = [&xform_view, &hierarchy_pool, &world_to_ndc_xform, camera_changed, since_tick](EntityID entity_id) {
+
+            // Entities in a hierarchy use the world matrix computed by the Hierarchy_System
+            const Hierarchy_Component* hierarchy = hierarchy_pool.has(entity_id) ? &hierarchy_pool.read(entity_id) : nullptr;
+
+            bool changed = xform_view.changed_since(entity_id, since_tick) ||
+                (hierarchy && hierarchy_pool.changed_since(entity_id, since_tick));
+            if (!changed && !camera_changed) {
+                return;
             }
 
-            // Compute object scale matrix
-            glm::mat3 scale_mat{ transform.scale.x, 0, 0,
-                                    0, transform.scale.y, 0,
-                                    0, 0, 1 };
+            auto [graphics, transform] = xform_view.get(entity_id);
+
+            if (changed && hierarchy) {
+                graphics.mdl_to_world_xform = hierarchy->world_xform;
+            }
+            else if (changed) {
+
+                // Compute object scale matrix
+                glm::mat3 scale_mat{ transform.scale.x, 0, 0,
+                                        0, transform.scale.y, 0,
+                                        0, 0, 1 };
+
+                // Compute current orientation of object
+                GLfloat rad_disp = glm::radians(transform.orientation.x);
+
+                // Compute object rotational matrix 
+                glm::mat3 rot_mat{ glm::cos(rad_disp),  glm::sin(rad_disp), 0,
+                                    -glm::sin(rad_disp),  glm::cos(rad_disp), 0,
+                                    0,                   0,                  1 };
 
-            // Compute current orientation of object
-            GLfloat rad_disp = glm::radians(transform.orientation.x);
+                // Compute object translation matrix
+                glm::mat3 trans_mat{ 1, 0, 0,
+                                        0, 1, 0,
+                                        transform.position.x, transform.position.y, 1 };
 
-            // Compute object rotational matrix 
-            glm::mat3 rot_mat{ glm::cos(rad_disp),  glm::sin(rad_disp), 0,
-                                -glm::sin(rad_disp),  glm::cos(rad_disp), 0,
-                                0,                   0,                  1 };
+                graphics.mdl_to_world_xform = trans_mat * rot_mat * scale_mat;
+            }
 
-            // Compute object translation matrix
-            glm::mat3 trans_mat{ 1, 0, 0,
-                                    0, 1, 0,
-                                    transform.position.x, transform.position.y, 1 };
+            graphics.mdl_to_ndc_xform = world_to_ndc_xform * graphics.mdl_to_world_xform;
+        };
 
-            graphics.mdl_to_ndc_xform = camera.world_to_ndc_xform * trans_mat * rot_mat * scale_mat;
+        if (is_parallel()) {
+            const auto& entity_list = get_entities().data();
+            JM.parallel_for(entity_list.size(), DEFAULT_PARALLEL_GRAIN, [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    compute_xform(entity_list[i]);
+                }
+            });
+        }
+        else {
+            for (EntityID entity_id : get_entities()) {
+                compute_xform(entity_id);
+            }
         }
 
         // Render polygon according to rendering mode 
@@ -195,11 +270,14 @@ namespace lof {
         GLfloat screen_width = static_cast<GLfloat>(SM.get_scr_width());
         GLfloat screen_height = static_cast<GLfloat>(SM.get_scr_height());
 
-        // Loop over the entities that match the system's signature
-        for (EntityID entity_id : get_entities()) {
+        // Sprites and text are drawn from their own groups, resolving the optional pools once
+        auto render_view = ECSM.view<const Graphics_Component, const Transform2D>();
+        const auto& text_pool = ECSM.get_component_pool<Text_Component>();
+        const auto& animation_pool = ECSM.get_component_pool<Animation_Component>();
+        const auto& background_pool = ECSM.get_component_pool<Background_Tag>();
+        for (EntityID entity_id : get_group(sprite_group)) {
 
-            auto& graphics = ECSM.get_component<Graphics_Component>(entity_id);
-            auto& transform = ECSM.get_component<Transform2D>(entity_id);
+            auto [graphics, transform] = render_view.get(entity_id);
 
             // Get shaders, models, textures, animation, and camera from the Graphics Manager
             Assets_Manager::ShaderProgram* shader = ASM.get_shader_program(graphics.shd_ref);
@@ -208,90 +286,6 @@ namespace lof {
             auto& animations = GFXM.get_animation_storage();
             auto& camera = GFXM.get_camera();
 
-            // Check for text objects to render 
-            bool is_text = ECSM.has_component<Text_Component>(entity_id);
-            if (is_text == true) {
-
-                auto& text_comp = ECSM.get_component<Text_Component>(entity_id);
-                auto& fonts = GFXM.get_font_storage();
-
-                // Start the shader program used for text rendering
-                GFXM.program_use(shader->program_handle);
-
-                // Set text color in fragment shader
-                GLuint text_color_uniform_loc = glGetUniformLocation(shader->program_handle, "uTextColor");
-                if (text_color_uniform_loc >= 0) {
-                    glUniform3fv(text_color_uniform_loc, 1, &text_comp.color[0]);
-                }
-                else {
-                    LM.write_log("Render_System::draw(): Text colour uniform variable doesn't exist.");
-                    std::exit(EXIT_FAILURE);
-                }
-
-                // Pass object's mdl_to_ndc_xform to vertex shader to compute object's final position
-                GLint text_mat_uniform_loc = glGetUniformLocation(shader->program_handle, "uModel_to_NDC_Mat");
-                if (text_mat_uniform_loc >= 0) {
-                    glUniformMatrix3fv(text_mat_uniform_loc, 1, GL_FALSE, &graphics.mdl_to_ndc_xform[0][0]);
-                }
-                else {
-                    LM.write_log("Render_System::draw(): Matrix uniform variable doesn't exist.");
-                    std::exit(EXIT_FAILURE);
-                }
-
-                // Set texture unit and bind text object's VAO handle 
-                glActiveTexture(GL_TEXTURE0);
-                glBindVertexArray(fonts[text_comp.font_name].vaoid);
-
-                // Iterate through all characters
-                std::string::const_iterator c;
-                float base_x = transform.position.x;
-                for (c = text_comp.text.begin(); c != text_comp.text.end(); c++)
-                {
-                    // Get read-only values from character
-                    auto const& bearing = fonts[text_comp.font_name].characters[*c].Bearing;
-                    auto const& size = fonts[text_comp.font_name].characters[*c].Size;
-                    auto const& texture_id = fonts[text_comp.font_name].characters[*c].TextureID;
-                    auto const& advance = fonts[text_comp.font_name].characters[*c].Advance;
-
-                    // Calculate the position and size of character in world 
-                    float xpos = base_x + bearing.x * transform.scale.x;
-                    float ypos = transform.position.y - (size.y - bearing.y) * transform.scale.y;
-                    float w = size.x * transform.scale.x;
-                    float h = size.y * transform.scale.y;
-
-                    // Update VBO for each character
-                    float vertices[6][4] = {
-                        { xpos,     ypos + h,   0.0f, 0.0f },
-                        { xpos,     ypos,       0.0f, 1.0f },
-                        { xpos + w, ypos,       1.0f, 1.0f },
-                        { xpos,     ypos + h,   0.0f, 0.0f },
-                        { xpos + w, ypos,       1.0f, 1.0f },
-                        { xpos + w, ypos + h,   1.0f, 0.0f }
-                    };
-
-                    // Set texture id to render
-                    glBindTexture(GL_TEXTURE_2D, texture_id);
-
-                    // Update content of VBO memory and unbind once completed
-                    glBindBuffer(GL_ARRAY_BUFFER, fonts[text_comp.font_name].vboid);
-                    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-                    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-                    // Render quad
-                    glDrawArrays(GL_TRIANGLES, 0, 6);
-
-                    // Advance cursors for next glyph 
-                    base_x += (advance >> 6) * transform.scale.x;
-                }
-                // Free VAO, texture id, and program once rendering completed
-                glBindVertexArray(0);
-                glBindTexture(GL_TEXTURE_2D, 0);
-                GFXM.program_free();
-
-                // Skip other rendering operations
-                continue;
-            }
-
             // Start the shader program that the entity will use for rendering 
             GFXM.program_use(shader->program_handle);
 
@@ -299,11 +293,11 @@ namespace lof {
             glBindVertexArray(models[graphics.model_name].vaoid);
 
             // Check if entity has a texture
-            if (graphics.texture_name != DEFAULT_TEXTURE_NAME) {
+            if (graphics.texture_name.get() != DEFAULT_TEXTURE_NAME) {
                 // Assign texture object to use texture image unit 5 
                 glBindTextureUnit(5, textures[graphics.texture_name]);
 
-                LM.write_log("Render_System::draw(): Texture name: %s.", graphics.texture_name.c_str());
+                LM.write_log("Render_System::draw(): Texture name: %s.", graphics.texture_name->c_str());
 
                 // Set texture flag to true
                 GLuint tex_flag_true_loc = glGetUniformLocation(shader->program_handle, "uTexFlag");
@@ -325,12 +319,13 @@ namespace lof {
                     std::exit(EXIT_FAILURE);
                 }
 
-                // If entity has animation, pass animation data to fragment shader
-                bool has_animation = ECSM.has_component<Animation_Component>(entity_id);
+                // If entity has animation, pass animation data to fragment shader. Animated sprites stay in
+                // the sprite group, since sprites have no layer and are drawn over each other in entity order
+                bool has_animation = animation_pool.has(entity_id);
                 if (has_animation == true) {
 
-                    auto& animation = ECSM.get_component<Animation_Component>(entity_id);
-                    std::string const& curr_animation_name = animation.animations[std::to_string(animation.curr_animation_idx)];
+                    const Animation_Component& animation = animation_pool.read(entity_id);
+                    std::string const& curr_animation_name = animation.get_animation_name(animation.curr_animation_idx);
                     unsigned int& curr_frame_idx = animations[curr_animation_name].curr_frame_index;
 
                     // Set animation flag to be true
@@ -415,7 +410,8 @@ namespace lof {
             }
 
             // Render objects
-            if (entity_id == 0) { // Set background object to always render in fill mode
+            bool is_background = background_pool.has(entity_id);
+            if (is_background) { // Set background object to always render in fill mode
                 glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
                 glDrawElements(models[graphics.model_name].primitive_type, models[graphics.model_name].draw_cnt, GL_UNSIGNED_SHORT, NULL);
                 glPolygonMode(GL_FRONT_AND_BACK, GFXM.get_render_mode());
@@ -425,7 +421,7 @@ namespace lof {
             }
 
             // Draw debugging features if debug mode is ON 
-            if (entity_id != 0) { // Background object unaffected 
+            if (!is_background) { // Background object unaffected 
                 if (GFXM.get_debug_mode() == GL_TRUE) {
                     // Check if entity has Velocity_Component and Collision_Component
                     bool has_velocity = ECSM.has_component<Velocity_Component>(entity_id);
@@ -459,7 +455,7 @@ namespace lof {
 
                         // Drawing collision box if entity has Collision_Component
                         if (has_collision) {
-                            auto& collision = ECSM.get_component<Collision_Component>(entity_id);
+                            const Collision_Component& collision = ECSM.get_component_pool<Collision_Component>().read(entity_id);
 
                             std::vector<glm::mat3> box_mdl_to_ndc_xform;
 
@@ -503,7 +499,7 @@ namespace lof {
 
                         // Drawing velocity vector if entity has Velocity_Component
                         if (has_velocity) {
-                            auto& velocity = ECSM.get_component<Velocity_Component>(entity_id);
+                            const Velocity_Component& velocity = ECSM.get_component_pool<Velocity_Component>().read(entity_id);
 
                             // Compute line scale matrix
                             glm::mat3 scale_mat{ transform.scale.x * DEFAULT_VELOCITY_LINE_LENGTH, 0, 0,
@@ -569,6 +565,90 @@ namespace lof {
             glBindTexture(GL_TEXTURE_2D, 0);
             GFXM.program_free();
         }
+
+        // Draw text after the sprites, so it is never hidden behind them
+        for (EntityID entity_id : get_group(text_group)) {
+
+            auto [graphics, transform] = render_view.get(entity_id);
+
+            // Get the shader and fonts from the Graphics Manager
+            Assets_Manager::ShaderProgram* shader = ASM.get_shader_program(graphics.shd_ref);
+            const Text_Component& text_comp = text_pool.read(entity_id);
+            auto& fonts = GFXM.get_font_storage();
+
+            // Start the shader program used for text rendering
+            GFXM.program_use(shader->program_handle);
+
+            // Set text color in fragment shader
+            GLuint text_color_uniform_loc = glGetUniformLocation(shader->program_handle, "uTextColor");
+            if (text_color_uniform_loc >= 0) {
+                glUniform3fv(text_color_uniform_loc, 1, &text_comp.color[0]);
+            }
+            else {
+                LM.write_log("Render_System::draw(): Text colour uniform variable doesn't exist.");
+                std::exit(EXIT_FAILURE);
+            }
+
+            // Pass object's mdl_to_ndc_xform to vertex shader to compute object's final position
+            GLint text_mat_uniform_loc = glGetUniformLocation(shader->program_handle, "uModel_to_NDC_Mat");
+            if (text_mat_uniform_loc >= 0) {
+                glUniformMatrix3fv(text_mat_uniform_loc, 1, GL_FALSE, &graphics.mdl_to_ndc_xform[0][0]);
+            }
+            else {
+                LM.write_log("Render_System::draw(): Matrix uniform variable doesn't exist.");
+                std::exit(EXIT_FAILURE);
+            }
+
+            // Set texture unit and bind text object's VAO handle 
+            glActiveTexture(GL_TEXTURE0);
+            glBindVertexArray(fonts[text_comp.font_name].vaoid);
+
+            // Iterate through all characters
+            std::string::const_iterator c;
+            float base_x = transform.position.x;
+            for (c = text_comp.text.begin(); c != text_comp.text.end(); c++)
+            {
+                // Get read-only values from character
+                auto const& bearing = fonts[text_comp.font_name].characters[*c].Bearing;
+                auto const& size = fonts[text_comp.font_name].characters[*c].Size;
+                auto const& texture_id = fonts[text_comp.font_name].characters[*c].TextureID;
+                auto const& advance = fonts[text_comp.font_name].characters[*c].Advance;
+
+                // Calculate the position and size of character in world 
+                float xpos = base_x + bearing.x * transform.scale.x;
+                float ypos = transform.position.y - (size.y - bearing.y) * transform.scale.y;
+                float w = size.x * transform.scale.x;
+                float h = size.y * transform.scale.y;
+
+                // Update VBO for each character
+                float vertices[6][4] = {
+                    { xpos,     ypos + h,   0.0f, 0.0f },
+                    { xpos,     ypos,       0.0f, 1.0f },
+                    { xpos + w, ypos,       1.0f, 1.0f },
+                    { xpos,     ypos + h,   0.0f, 0.0f },
+                    { xpos + w, ypos,       1.0f, 1.0f },
+                    { xpos + w, ypos + h,   1.0f, 0.0f }
+                };
+
+                // Set texture id to render
+                glBindTexture(GL_TEXTURE_2D, texture_id);
+
+                // Update content of VBO memory and unbind once completed
+                glBindBuffer(GL_ARRAY_BUFFER, fonts[text_comp.font_name].vboid);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+                // Render quad
+                glDrawArrays(GL_TRIANGLES, 0, 6);
+
+                // Advance cursors for next glyph 
+                base_x += (advance >> 6) * transform.scale.x;
+            }
+            // Free VAO, texture id, and program once rendering completed
+            glBindVertexArray(0);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            GFXM.program_free();
+        }
         if (GFXM.get_editor_mode() == 1) {
             glBindFramebuffer(GL_FRAMEBUFFER, 0); // FOR TESTING
         }
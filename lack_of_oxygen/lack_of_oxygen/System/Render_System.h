@@ -50,6 +50,11 @@ namespace lof {
         void update(float delta_time) override;
 
     private:
+        std::uint32_t last_update_tick = 0;                            ///< Change tick at the start of the last update
+        glm::mat3 last_world_to_ndc_xform = DEFAULT_MDL_TO_NDC_MAT;    ///< Camera matrix used by the last update
+        std::size_t sprite_group = 0;                                  ///< Group of the entities drawn as sprites
+        std::size_t text_group = 0;                                    ///< Group of the entities drawn as text
+
         /**
          * @brief Renders entities onto the window based on their components.
          */
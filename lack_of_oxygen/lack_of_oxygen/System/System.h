@@ -13,11 +13,12 @@
 
 // Include standard headers
 #include <string>
-#include <unordered_set>       // For std::unordered_set
+#include <vector>
 
 // Include other necessary headers
 #include "../Utility/Constant.h"
 #include "../Utility/Type.h"  // Include shared types
+#include "../Utility/Sparse_Set.h" // For Sparse_Set
 
 namespace lof {
 
@@ -26,14 +27,53 @@ namespace lof {
      * @brief Abstract base class for all systems in the ECS.
      */
     class System { 
+    private:
+        /**
+         * @struct Entity_Group
+         * @brief A subset of the system's entities that also match a signature of its own.
+         */
+        struct Entity_Group {
+            Signature signature;                  ///< Components required on top of the system's signature
+            Signature exclude_signature;          ///< Components that keep an entity out of the group
+            Sparse_Set entities;                  ///< System entities matching the group's signature
+        };
+
+        std::vector<Entity_Group> groups;         ///< Groups the system processes separately
+
     protected:
         Signature signature;                      ///< Components required by the system
-        std::unordered_set<EntityID> entities;    ///< Entities matching the system's signature
+        Signature exclude_signature;              ///< Components, usually tags, that keep an entity out of the system
+        Sparse_Set entities;                      ///< Entities matching the system's signature
+        Signature read_signature;                 ///< Components only read during update
+        Signature write_signature;                ///< Components written during update
+        Resource_Mask read_resources;             ///< Shared state outside the pools only read during update
+        Resource_Mask write_resources;            ///< Shared state outside the pools written during update
+        bool main_thread_only = false;            ///< True if update makes OpenGL or GLFW calls
+        bool parallel = false;                    ///< True if update splits its entity range across worker threads
+        bool spatially_ordered = false;           ///< True if the entity list may be sorted by position
+
+        /**
+         * @brief Add a group of entities for update to loop over on its own, set up in the constructor.
+         * @param required Components an entity of the system also needs to be in the group.
+         * @param excluded Components that keep an entity of the system out of the group.
+         * @return The index of the group, passed to get_group.
+         */
+        std::size_t add_group(const Signature& required, const Signature& excluded = Signature()) {
+            groups.push_back(Entity_Group{ required, excluded, Sparse_Set() });
+            return groups.size() - 1;
+        }
 
     private:
 
         int64_t system_time = DEFAULT_START_TIME; // Private data member to store system's consumption time in game loop.
 
+        float update_interval = 0.0f;             ///< Seconds between updates, 0 to update every frame
+        float time_until_update = 0.0f;           ///< Seconds left before the next update is due
+        float accumulated_time = 0.0f;            ///< Frame time elapsed since the last update
+        unsigned int pending_frames = 0;          ///< Frames elapsed since the last update
+        float update_delta = 0.0f;                ///< Time covered by the current update
+        unsigned int frame_stride = 1;            ///< Frames covered by the current update
+
     public:
         /**
          * @brief Pure virtual function to update the system.
@@ -82,6 +122,29 @@ namespace lof {
          */
         void remove_entity(EntityID entity) {
             entities.erase(entity);
+            for (Entity_Group& group : groups) {
+                group.entities.erase(entity);
+            }
+        }
+
+        /**
+         * @brief Add or remove an entity of the system from its groups.
+         * @details Called after the system's own membership is updated, since a component added
+         *          or removed can move an entity between groups without changing that membership.
+         * @param entity The ID of the entity to update.
+         * @param mask The component mask of the entity.
+         */
+        void update_groups(EntityID entity, const ComponentMask& mask) {
+            bool member = entities.contains(entity);
+            for (Entity_Group& group : groups) {
+                bool matches = member && (mask & group.signature) == group.signature && (mask & group.exclude_signature).none();
+                if (matches) {
+                    group.entities.insert(entity);
+                }
+                else {
+                    group.entities.erase(entity);
+                }
+            }
         }
 
         /**
@@ -92,17 +155,212 @@ namespace lof {
             return signature;
         }
 
+        /**
+         * @brief Get the components that exclude an entity from the system.
+         * @return The system's exclusion signature.
+         */
+        const Signature& get_exclude_signature() const {
+            return exclude_signature;
+        }
+
+        /**
+         * @brief Get every component that can change which entities the system or its groups hold.
+         * @return The required and excluded components of the system and of each group.
+         */
+        Signature get_membership_signature() const {
+            Signature membership = signature | exclude_signature;
+            for (const Entity_Group& group : groups) {
+                membership |= group.signature | group.exclude_signature;
+            }
+            return membership;
+        }
+
+        /**
+         * @brief Check if a component mask matches the system.
+         * @param mask The component mask of an entity.
+         * @return True if the mask has every required component and none of the excluded ones.
+         */
+        bool matches(const ComponentMask& mask) const {
+            return (mask & signature) == signature && (mask & exclude_signature).none();
+        }
+
+        /**
+         * @brief Get the components the system only reads during update.
+         * @return The system's read signature.
+         */
+        const Signature& get_read_signature() const {
+            return read_signature;
+        }
+
+        /**
+         * @brief Get the components the system writes during update.
+         * @return The system's write signature.
+         */
+        const Signature& get_write_signature() const {
+            return write_signature;
+        }
+
+        /**
+         * @brief Check if the system must be updated on the main thread.
+         * @return True if the system cannot run on a worker thread.
+         */
+        bool is_main_thread_only() const {
+            return main_thread_only;
+        }
+
+        /**
+         * @brief Enable or disable splitting the system's entity range across worker threads.
+         * @param enable True to process entities with the Job_Manager, false to process them in order.
+         */
+        void set_parallel(bool enable) {
+            parallel = enable;
+        }
+
+        /**
+         * @brief Check if the system splits its entity range across worker threads.
+         * @return True if parallel processing is enabled.
+         */
+        bool is_parallel() const {
+            return parallel;
+        }
+
+        /**
+         * @brief Check if the ECS_Manager may sort the system's entity list by position.
+         * @return True for systems whose results do not depend on entity order.
+         */
+        bool is_spatially_ordered() const {
+            return spatially_ordered;
+        }
+
+        /**
+         * @brief Rearrange the system's entity list to follow a given order.
+         * @param order The preferred order of entity IDs.
+         */
+        void reorder_entities(const std::vector<EntityID>& order) {
+            entities.reorder(order);
+        }
+
+        /**
+         * @brief Set how often the system is updated.
+         * @param rate Updates per second, or 0 to update every frame.
+         */
+        void set_update_rate(float rate) {
+            update_interval = rate > 0.0f ? 1.0f / rate : 0.0f;
+            time_until_update = 0.0f;
+        }
+
+        /**
+         * @brief Get the time between updates of the system.
+         * @return Seconds between updates, 0 if the system updates every frame.
+         */
+        float get_update_interval() const {
+            return update_interval;
+        }
+
+        /**
+         * @brief Delay the first update so systems sharing a rate fall on different frames.
+         * @param offset Seconds to wait before the first update, less than the update interval.
+         */
+        void set_update_phase(float offset) {
+            time_until_update = offset;
+        }
+
+        /**
+         * @brief Advance the system's clock by a frame and check if it is due for an update.
+         * @details Called once per frame by the ECS_Manager. When the system is due, the frame time
+         *          and frame count since its last update become its update delta and frame stride.
+         *          After a long stall the system updates once rather than catching up.
+         * @param delta_time The time elapsed in this frame.
+         * @return True if the system should update this frame.
+         */
+        bool advance_frame(float delta_time) {
+            accumulated_time += delta_time;
+            ++pending_frames;
+
+            if (update_interval > 0.0f) {
+                time_until_update -= delta_time;
+                if (time_until_update > 0.0f) {
+                    return false;
+                }
+                time_until_update += update_interval;
+                if (time_until_update <= 0.0f) {
+                    time_until_update = update_interval;
+                }
+            }
+
+            update_delta = accumulated_time;
+            frame_stride = pending_frames;
+            accumulated_time = 0.0f;
+            pending_frames = 0;
+            return true;
+        }
+
+        /**
+         * @brief Get the time covered by the current update, which is passed to update().
+         * @return Seconds elapsed since the system's previous update.
+         */
+        float get_update_delta() const {
+            return update_delta;
+        }
+
+        /**
+         * @brief Get the number of frames covered by the current update.
+         * @return 1 for systems updated every frame, more for systems with a lower update rate.
+         */
+        unsigned int get_frame_stride() const {
+            return frame_stride;
+        }
+
+        /**
+         * @brief Check if the system is updated while the level editor is active.
+         * @return True by default, overridden by gameplay systems that pause in the editor.
+         */
+        virtual bool runs_in_editor() const {
+            return true;
+        }
+
+        /**
+         * @brief Check if two systems cannot be updated at the same time.
+         * @details Systems conflict when either writes a component or resource the other accesses.
+         *          A system that declares no access is assumed to conflict with every system.
+         * @param other The system to check against.
+         * @return True if the systems must be updated one after the other.
+         */
+        bool conflicts_with(const System& other) const {
+            if (((read_signature | write_signature).none() && (read_resources | write_resources).none()) ||
+                ((other.read_signature | other.write_signature).none() && (other.read_resources | other.write_resources).none())) {
+                return true;
+            }
+            return (write_signature & (other.read_signature | other.write_signature)).any() ||
+                (other.write_signature & read_signature).any() ||
+                (write_resources & (other.read_resources | other.write_resources)).any() ||
+                (other.write_resources & read_resources).any();
+        }
+
         /**
          * @brief Get the list of entities the system processes.
-         * @return A constant reference to the set of entity IDs.
+         * @return A constant reference to the set of entity IDs, iterated in packed order.
          */
-        const std::unordered_set<EntityID>& get_entities() const {
+        const Sparse_Set& get_entities() const {
             return entities;
         }
 
-        // Add this to System.h in the System class:
+        /**
+         * @brief Check if the system processes an entity.
+         * @param entity The ID of the entity to check.
+         * @return True if the entity is in the system's entity list, false otherwise.
+         */
         bool has_entity(EntityID entity) const {
-            return entities.find(entity) != entities.end();
+            return entities.contains(entity);
+        }
+
+        /**
+         * @brief Get the entities of a group added by the system.
+         * @param group The index returned by add_group.
+         * @return A constant reference to the group's set of entity IDs, iterated in packed order.
+         */
+        const Sparse_Set& get_group(std::size_t group) const {
+            return groups[group].entities;
         }
     };
 } // namespace lof
@@ -0,0 +1,239 @@
+/**
+ * @file Tile_Layer.cpp
+ * @brief Implements the Tile_Layer class, an occupancy grid of static level geometry.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+
+// Include header file
+#include "Tile_Layer.h"
+
+// Include other necessary headers
+#include "AABB.h"
+
+// Include standard headers
+#include <algorithm>
+#include <cmath>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace lof {
+
+    namespace {
+        /**
+         * @brief Get the cell holding a coordinate, clamped to a grid of a given number of cells.
+         */
+        std::uint32_t cell_of(float value, float origin, float size, std::uint32_t count) {
+            float cell = std::floor((value - origin) / size);
+            if (!(cell > 0.0f)) {
+                return 0;
+            }
+            if (cell >= static_cast<float>(count - 1)) {
+                return count - 1;
+            }
+            return static_cast<std::uint32_t>(cell);
+        }
+
+        /**
+         * @brief Get a word with the bits from first to last set, both within the same word.
+         */
+        std::uint64_t bit_range(std::uint32_t first, std::uint32_t last) {
+            std::uint64_t upto_last = (last == 63) ? ~0ull : ((1ull << (last + 1)) - 1);
+            return upto_last & ~((1ull << first) - 1);
+        }
+
+        /**
+         * @brief Get the index of the lowest set bit of a non-zero word.
+         */
+        std::uint32_t lowest_set_bit(std::uint64_t word) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            unsigned long bit = 0;
+            _BitScanForward64(&bit, word);
+            return static_cast<std::uint32_t>(bit);
+#elif defined(_MSC_VER)
+            // 32-bit targets only scan 32 bits at a time
+            unsigned long bit = 0;
+            if (_BitScanForward(&bit, static_cast<unsigned long>(word))) {
+                return static_cast<std::uint32_t>(bit);
+            }
+            _BitScanForward(&bit, static_cast<unsigned long>(word >> 32));
+            return static_cast<std::uint32_t>(bit) + 32;
+#else
+            return static_cast<std::uint32_t>(__builtin_ctzll(word));
+#endif
+        }
+    }
+
+    Tile_Layer::Tile_Layer(float tile_size)
+        : tile_size(tile_size > 0.0f ? tile_size : DEFAULT_TILE_SIZE) {}
+
+    Tile_Layer::~Tile_Layer() = default;
+
+    void Tile_Layer::set_tile_size(float size) {
+        if (size > 0.0f) {
+            tile_size = size;
+        }
+    }
+
+    float Tile_Layer::get_cell_size() const {
+        return baked_tile_size;
+    }
+
+    std::uint32_t Tile_Layer::column_of(float x) const {
+        return cell_of(x, origin.x, baked_tile_size, columns);
+    }
+
+    std::uint32_t Tile_Layer::row_of(float y) const {
+        return cell_of(y, origin.y, baked_tile_size, rows);
+    }
+
+    void Tile_Layer::bake(const std::vector<EntityID>& tile_entities, const std::vector<AABB>& tile_boxes) {
+        clear();
+        if (tile_boxes.empty()) {
+            return;
+        }
+        entities = tile_entities;
+        boxes = tile_boxes;
+
+        // Cover the union of the tiles, with cells large enough to stay within the budget
+        Vec2D min = boxes[0].min;
+        Vec2D max = boxes[0].max;
+        for (const AABB& box : boxes) {
+            min.x = std::min(min.x, box.min.x);
+            min.y = std::min(min.y, box.min.y);
+            max.x = std::max(max.x, box.max.x);
+            max.y = std::max(max.y, box.max.y);
+        }
+
+        baked_tile_size = tile_size;
+        double cells_x = 0.0;
+        double cells_y = 0.0;
+        for (;;) {
+            cells_x = std::floor((static_cast<double>(max.x) - min.x) / baked_tile_size) + 1.0;
+            cells_y = std::floor((static_cast<double>(max.y) - min.y) / baked_tile_size) + 1.0;
+            if (cells_x * cells_y <= static_cast<double>(MAX_TILE_LAYER_CELLS)) {
+                break;
+            }
+            baked_tile_size *= 2.0f;
+        }
+
+        origin = min;
+        extent = max;
+        columns = static_cast<std::uint32_t>(cells_x);
+        rows = static_cast<std::uint32_t>(cells_y);
+        words_per_row = (columns + 63) / 64;
+        bits.assign(static_cast<std::size_t>(words_per_row) * rows, 0);
+
+        // Count the tiles of each cell, then list them, so each cell's tiles are contiguous
+        std::size_t cell_count = static_cast<std::size_t>(columns) * rows;
+        cell_first.assign(cell_count + 1, 0);
+        for (const AABB& box : boxes) {
+            std::uint32_t x0 = column_of(box.min.x), x1 = column_of(box.max.x);
+            std::uint32_t y0 = row_of(box.min.y), y1 = row_of(box.max.y);
+            for (std::uint32_t y = y0; y <= y1; ++y) {
+                for (std::uint32_t x = x0; x <= x1; ++x) {
+                    ++cell_first[static_cast<std::size_t>(y) * columns + x + 1];
+                }
+            }
+        }
+        for (std::size_t cell = 0; cell < cell_count; ++cell) {
+            cell_first[cell + 1] += cell_first[cell];
+        }
+
+        cell_tiles.resize(cell_first[cell_count]);
+        std::vector<std::uint32_t> next(cell_first.begin(), cell_first.end() - 1);
+        for (std::uint32_t tile = 0; tile < boxes.size(); ++tile) {
+            const AABB& box = boxes[tile];
+            std::uint32_t x0 = column_of(box.min.x), x1 = column_of(box.max.x);
+            std::uint32_t y0 = row_of(box.min.y), y1 = row_of(box.max.y);
+            for (std::uint32_t y = y0; y <= y1; ++y) {
+                std::uint64_t* row = &bits[static_cast<std::size_t>(y) * words_per_row];
+                for (std::uint32_t x = x0; x <= x1; ++x) {
+                    row[x / 64] |= 1ull << (x % 64);
+                    cell_tiles[next[static_cast<std::size_t>(y) * columns + x]++] = tile;
+                }
+            }
+        }
+    }
+
+    void Tile_Layer::clear() {
+        columns = 0;
+        rows = 0;
+        words_per_row = 0;
+        bits.clear();
+        cell_first.clear();
+        cell_tiles.clear();
+        entities.clear();
+        boxes.clear();
+    }
+
+    void Tile_Layer::query(const AABB& box, std::vector<std::uint32_t>& found) const {
+        found.clear();
+        if (boxes.empty()) {
+            return;
+        }
+
+        // Boxes outside the tiles' bounds, or with NaN bounds, cannot touch a tile
+        if (!(box.max.x >= origin.x && box.min.x <= extent.x &&
+            box.max.y >= origin.y && box.min.y <= extent.y)) {
+            return;
+        }
+
+        std::uint32_t x0 = column_of(box.min.x), x1 = column_of(box.max.x);
+        std::uint32_t y0 = row_of(box.min.y), y1 = row_of(box.max.y);
+        std::uint32_t first_word = x0 / 64, last_word = x1 / 64;
+
+        for (std::uint32_t y = y0; y <= y1; ++y) {
+            const std::uint64_t* row = &bits[static_cast<std::size_t>(y) * words_per_row];
+            for (std::uint32_t word = first_word; word <= last_word; ++word) {
+                std::uint32_t first_bit = (word == first_word) ? x0 % 64 : 0;
+                std::uint32_t last_bit = (word == last_word) ? x1 % 64 : 63;
+                std::uint64_t occupied = row[word] & bit_range(first_bit, last_bit);
+
+                // Visit each set bit, lowest first
+                while (occupied) {
+                    std::uint32_t bit = lowest_set_bit(occupied);
+                    occupied &= occupied - 1;
+
+                    std::size_t cell = static_cast<std::size_t>(y) * columns + word * 64 + bit;
+                    found.insert(found.end(), cell_tiles.begin() + cell_first[cell], cell_tiles.begin() + cell_first[cell + 1]);
+                }
+            }
+        }
+
+        // Tiles covering several cells were listed once for each
+        std::sort(found.begin(), found.end());
+        found.erase(std::unique(found.begin(), found.end()), found.end());
+    }
+
+    bool Tile_Layer::is_occupied(const Vec2D& point) const {
+        if (boxes.empty() ||
+            !(point.x >= origin.x && point.x <= extent.x && point.y >= origin.y && point.y <= extent.y)) {
+            return false;
+        }
+        std::uint32_t x = column_of(point.x);
+        std::uint32_t y = row_of(point.y);
+        return (bits[static_cast<std::size_t>(y) * words_per_row + x / 64] >> (x % 64)) & 1ull;
+    }
+
+    EntityID Tile_Layer::get_entity(std::uint32_t tile) const {
+        return entities[tile];
+    }
+
+    const AABB& Tile_Layer::get_box(std::uint32_t tile) const {
+        return boxes[tile];
+    }
+
+    const std::vector<EntityID>& Tile_Layer::get_entities() const {
+        return entities;
+    }
+
+    std::size_t Tile_Layer::size() const {
+        return boxes.size();
+    }
+
+} // namespace lof
@@ -0,0 +1,144 @@
+/**
+ * @file Tile_Layer.h
+ * @brief Declares the Tile_Layer class, an occupancy grid of static level geometry.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_TILE_LAYER_H
+#define LOF_TILE_LAYER_H
+
+// Include standard headers
+#include <cstdint>
+#include <vector>
+
+// Include other necessary headers
+#include "../Utility/Constant.h"
+#include "../Utility/Vector2D.h"
+#include "../Utility/Type.h" // For EntityID
+
+namespace lof {
+
+    struct AABB;
+
+    /**
+     * @class Tile_Layer
+     * @brief Uniform grid of the boxes of static colliders, baked once and only read afterwards.
+     * @details Each row of the grid is a run of bits, one per cell, set where a tile covers the
+     *          cell. A query walks the bits of the rows a box covers a word at a time, so empty
+     *          space costs one test per 64 cells, and collects the tiles listed for each set cell.
+     *          The tiles keep their exact boxes, so the grid only decides which tiles to test and
+     *          tiles do not need to line up with it. The grid covers the union of the tiles, and
+     *          the tile size is doubled while it would need more than MAX_TILE_LAYER_CELLS cells.
+     */
+    class Tile_Layer {
+    private:
+        float tile_size;                            ///< Width and height of a cell in world units
+        float baked_tile_size = 0.0f;               ///< Cell size the grid was baked with
+        Vec2D origin;                               ///< Minimum corner of the union of the tiles, and of the first cell
+        Vec2D extent;                               ///< Maximum corner of the union of the tiles
+        std::uint32_t columns = 0;                  ///< Number of cells in each row
+        std::uint32_t rows = 0;                     ///< Number of rows
+        std::uint32_t words_per_row = 0;            ///< Number of 64-bit words in each row
+        std::vector<std::uint64_t> bits;            ///< Occupancy of every cell, row by row
+        std::vector<std::uint32_t> cell_first;      ///< Start of each cell's tiles in cell_tiles, plus the end
+        std::vector<std::uint32_t> cell_tiles;      ///< Tiles covering each cell, cell by cell
+        std::vector<EntityID> entities;             ///< Entity of each tile
+        std::vector<AABB> boxes;                    ///< Box of each tile
+
+        /**
+         * @brief Get the cell column holding an x coordinate, clamped to the grid.
+         */
+        std::uint32_t column_of(float x) const;
+
+        /**
+         * @brief Get the cell row holding a y coordinate, clamped to the grid.
+         */
+        std::uint32_t row_of(float y) const;
+
+    public:
+        /**
+         * @brief Constructor for Tile_Layer.
+         * @param tile_size Width and height of a cell in world units.
+         */
+        explicit Tile_Layer(float tile_size = DEFAULT_TILE_SIZE);
+
+        /**
+         * @brief Destructor for Tile_Layer.
+         */
+        ~Tile_Layer();
+
+        /**
+         * @brief Set the cell size used by the next bake.
+         * @param size Width and height of a cell in world units, ignored if not positive.
+         */
+        void set_tile_size(float size);
+
+        /**
+         * @brief Get the cell size of the last bake.
+         * @return Width and height of a cell in world units, larger than the set size if the
+         *         tiles were spread too wide for it.
+         */
+        float get_cell_size() const;
+
+        /**
+         * @brief Replace the layer with the boxes of a set of tiles.
+         * @param tile_entities The entity owning each box.
+         * @param tile_boxes The boxes to bake, which must have finite bounds.
+         */
+        void bake(const std::vector<EntityID>& tile_entities, const std::vector<AABB>& tile_boxes);
+
+        /**
+         * @brief Remove every tile.
+         */
+        void clear();
+
+        /**
+         * @brief Find the tiles listed in the cells a box covers.
+         * @details Every tile whose box overlaps the given box, touching edges included, is found,
+         *          along with nearby tiles the caller can reject with their exact boxes.
+         * @param box The box to test.
+         * @param found Output for the tile indices, replacing its contents, sorted and unique.
+         */
+        void query(const AABB& box, std::vector<std::uint32_t>& found) const;
+
+        /**
+         * @brief Check if any tile covers the cell holding a point.
+         * @param point The point to test.
+         * @return True if the cell holding the point is occupied, false otherwise.
+         */
+        bool is_occupied(const Vec2D& point) const;
+
+        /**
+         * @brief Get the entity of a tile.
+         * @param tile Index of the tile.
+         * @return The entity the tile was baked from.
+         */
+        EntityID get_entity(std::uint32_t tile) const;
+
+        /**
+         * @brief Get the box of a tile.
+         * @param tile Index of the tile.
+         * @return Const reference to the tile's box.
+         */
+        const AABB& get_box(std::uint32_t tile) const;
+
+        /**
+         * @brief Get the entities of every tile.
+         * @return The entities, in tile order.
+         */
+        const std::vector<EntityID>& get_entities() const;
+
+        /**
+         * @brief Get the number of tiles.
+         * @return The number of tiles baked into the layer.
+         */
+        std::size_t size() const;
+    };
+
+} // namespace lof
+
+#endif // LOF_TILE_LAYER_H
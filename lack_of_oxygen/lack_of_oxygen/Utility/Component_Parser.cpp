@@ -24,7 +24,8 @@
 
 namespace lof {
 
-    void Component_Parser::add_components_from_json(ECS_Manager& ecs_manager, EntityID entity, const rapidjson::Value& components) {
+    template<typename Target>
+    void Component_Parser::add_components_from_json(Target& target, EntityID entity, const rapidjson::Value& components) {
         for (auto it = components.MemberBegin(); it != components.MemberEnd(); ++it) {
             std::string component_name = it->name.GetString();
             const rapidjson::Value& component_data = it->value;
@@ -60,7 +61,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Transform2D>(entity, transform);
+                target.template add_component<Transform2D>(entity, transform);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Transform2D component to entity ID %u.", entity);
             }
             // ------------------------------------ Velocity_Component -------------------------------------------
@@ -74,7 +75,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Velocity_Component>(entity, velocity);
+                target.template add_component<Velocity_Component>(entity, velocity);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Velocity_Component to entity ID %u.", entity);
             }
             // ------------------------------------ Physics_Component -------------------------------------------
@@ -188,7 +189,14 @@ namespace lof {
 
 
                 // Add component to entity
-                ecs_manager.add_component<Physics_Component>(entity, physics_component);
+                target.template add_component<Physics_Component>(entity, physics_component);
+                if (physics_component.get_is_static()) {
+                    target.template add_component<Static_Tag>(entity, Static_Tag());
+                }
+                else if (target.template has_component<Static_Tag>(entity)) {
+                    // An override can make a static prefab dynamic
+                    target.template remove_component<Static_Tag>(entity);
+                }
                 LM.write_log("Component_Parser::add_components_from_json(): Added Physics_Component to entity ID %u.", entity);
             }
             // ------------------------------------ Graphics_Component -------------------------------------------
@@ -256,7 +264,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Graphics_Component>(entity, graphics_component);
+                target.template add_component<Graphics_Component>(entity, graphics_component);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Graphics_Component to entity ID %u.", entity);
             }
             // ------------------------------------ Collision_Component -------------------------------------------
@@ -273,7 +281,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Collision_Component>(entity, collision_component);
+                target.template add_component<Collision_Component>(entity, collision_component);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Collision_Component to entity ID %u.", entity);
             }
             // ------------------------------------- Audio_Component ---------------------------------------------
@@ -375,7 +383,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Audio_Component>(entity, audio_component);
+                target.template add_component<Audio_Component>(entity, audio_component);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Audio_Component to entity ID %u", entity);
 
                 // Log all sounds in the component for verification
@@ -413,7 +421,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<GUI_Component>(entity, gui_component);
+                target.template add_component<GUI_Component>(entity, gui_component);
                 LM.write_log("Component_Parser::add_components_from_json(): Added GUI_Component to entity ID %u.", entity);
             }
             // ------------------------------------ Animation_Component -------------------------------------------
@@ -460,7 +468,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Animation_Component>(entity, animation_component);
+                target.template add_component<Animation_Component>(entity, animation_component);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Animation_Component to entity ID %u.", entity);
                 }
             // ------------------------------------ Logic_Component -------------------------------------------
@@ -502,7 +510,7 @@ namespace lof {
                     logic.movement_range);
 
                 // Add component to entity
-                ecs_manager.add_component<Logic_Component>(entity, logic);
+                target.template add_component<Logic_Component>(entity, logic);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Logic_Component to entity ID %u.", entity);
                 }
             // ------------------------------------ Text_Component -------------------------------------------
@@ -526,7 +534,7 @@ namespace lof {
                 }
 
                 // Add component to entity
-                ecs_manager.add_component<Text_Component>(entity, text_component);
+                target.template add_component<Text_Component>(entity, text_component);
                 LM.write_log("Component_Parser::add_components_from_json(): Added Text_Component to entity ID %u.", entity);
                 }
             // ------------------------------------ Unknown Component -------------------------------------------
@@ -535,4 +543,8 @@ namespace lof {
             }
         }
     }
-} // namespace lof
\ No newline at end of file
+
+    // The parser fills both live entities and compiled prefab templates
+    template void Component_Parser::add_components_from_json<ECS_Manager>(ECS_Manager&, EntityID, const rapidjson::Value&);
+    template void Component_Parser::add_components_from_json<Prefab_Template>(Prefab_Template&, EntityID, const rapidjson::Value&);
+} // namespace lof
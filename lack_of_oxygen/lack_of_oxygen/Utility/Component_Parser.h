@@ -24,11 +24,14 @@ namespace lof {
     public:
         /**
          * @brief Parse components from JSON and add them to an entity.
-         * @param ecs_manager Reference to the ECS_Manager.
+         * @details Target is ECS_Manager to add to a live entity, or Prefab_Template to compile a
+         *          prefab once so that clones skip the JSON.
+         * @param target Reference to the ECS_Manager or Prefab_Template receiving the components.
          * @param entity The entity ID.
          * @param components The JSON value containing component data.
          */
-        static void add_components_from_json(ECS_Manager& ecs_manager, EntityID entity, const rapidjson::Value& components);
+        template<typename Target>
+        static void add_components_from_json(Target& target, EntityID entity, const rapidjson::Value& components);
     };
 
 } // namespace lof
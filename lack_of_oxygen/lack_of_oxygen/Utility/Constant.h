@@ -44,9 +44,37 @@ namespace lof {
 	constexpr float DEFAULT_DELTA_TIME = 0.0f;
 	constexpr int64_t DEFAULT_LAST_FRAME_START_TIME = 0;
 
+	// ----------------------------- Job_Manager.cpp -------------------------------------------
+	// Upper bound on worker threads spawned by the Job_Manager
+	constexpr unsigned int DEFAULT_MAX_WORKER_THREADS = 16;
+	// Maximum entities per chunk when a system splits its entities across worker threads
+	constexpr std::size_t DEFAULT_PARALLEL_GRAIN = 64;
+
+	// ----------------------------- Snapshot_Buffer.cpp ---------------------------------------
+	// Number of snapshots kept for rewinding and the frames between captures
+	constexpr std::size_t DEFAULT_SNAPSHOT_CAPACITY = 600;
+	constexpr unsigned int DEFAULT_SNAPSHOT_INTERVAL = 1;
+
+	// ----------------------------------- Main.cpp ---------------------------------------------
+	// Command line option that runs the headless world check instead of the game
+	constexpr char const* CHECK_WORLDS_OPTION = "--check-worlds";
+	// Frames and time step each world is updated with by the headless world check
+	constexpr int DEFAULT_CHECK_WORLDS_FRAMES = 600;
+	constexpr float DEFAULT_CHECK_WORLDS_DELTA_TIME = 1.0f / DEFAULT_TARGET_FPS;
+
+	// ----------------------------- ECS_Manager.cpp -------------------------------------------
+	// Frames between spatial sorts of the transform and physics pools (0 disables sorting)
+	constexpr unsigned int DEFAULT_SPATIAL_SORT_INTERVAL = 60;
+	// Width of the grid cells whose Morton codes order the pools, in world units
+	constexpr float DEFAULT_SPATIAL_SORT_CELL_SIZE = 64.0f;
+	// Average shifts per entity the incremental spatial sort may make before falling back to a full sort
+	constexpr std::size_t MAX_SPATIAL_SORT_SHIFTS_PER_ENTITY = 4;
+
 	// ------------------------- System.cpp and Manager.cpp Files -------------------------------
 	// System Performance Constants
 	constexpr int64_t DEFAULT_START_TIME = 0;
+	// Updates per second of systems that do not need to run every frame
+	constexpr float DEFAULT_AUDIO_UPDATE_RATE = 30.0f;
 
 	// ----------------------------------- FPS.cpp ----------------------------------------------
 	// System Performance Constants
@@ -147,6 +175,16 @@ namespace lof {
 	constexpr unsigned int	COLLISION_RIGHT = 0x00000002;	//0010
 	constexpr const unsigned int	COLLISION_TOP = 0x00000004;	//0100
 	constexpr const unsigned int	COLLISION_BOTTOM = 0x00000008;	//1000
+	// Width of the spatial hash cells used by the collision broadphase, in world units
+	constexpr float DEFAULT_COLLISION_CELL_SIZE = 128.0f;
+	// Boxes covering more cells than this skip the hash and are paired with every other box
+	constexpr std::size_t MAX_COLLISION_CELLS_PER_BOX = 64;
+	// Distance the boxes of moving bodies are enlarged by in the AABB tree broadphase, in world units
+	constexpr float DEFAULT_AABB_TREE_MARGIN = 8.0f;
+	// Width and height of a cell of the tile layer baked from static level geometry, in world units
+	constexpr float DEFAULT_TILE_SIZE = 64.0f;
+	// The tile layer doubles its cell size until the grid fits in this many cells
+	constexpr std::size_t MAX_TILE_LAYER_CELLS = 1 << 22;
 
 	// -------------------------- Common variables used in Systems -----------------------------------
 	constexpr char const* DEFAULT_PLAYER_NAME = "player1";
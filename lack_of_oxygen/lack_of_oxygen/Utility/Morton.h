@@ -0,0 +1,56 @@
+/**
+ * @file Morton.h
+ * @brief Defines helpers for computing Morton (Z-order) codes of 2D positions.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_MORTON_H
+#define LOF_MORTON_H
+
+// Include standard headers
+#include <cstdint>
+#include <cmath>
+
+namespace lof {
+
+    /**
+     * @brief Spread the bits of a 16-bit value so that a zero bit sits between each of them.
+     * @param value The value to spread.
+     * @return The value with bit i moved to bit 2i.
+     */
+    inline std::uint32_t spread_bits(std::uint32_t value) {
+        value &= 0x0000FFFFu;
+        value = (value | (value << 8)) & 0x00FF00FFu;
+        value = (value | (value << 4)) & 0x0F0F0F0Fu;
+        value = (value | (value << 2)) & 0x33333333u;
+        value = (value | (value << 1)) & 0x55555555u;
+        return value;
+    }
+
+    /**
+     * @brief Get the Morton code of the grid cell holding a world position.
+     * @details The grid is fixed and centred on the origin, so a position always maps to the same
+     *          code. Positions outside the 65536 x 65536 cell grid are clamped to its edge.
+     * @param x The world x coordinate.
+     * @param y The world y coordinate.
+     * @param cell_size The width and height of a grid cell in world units.
+     * @return The interleaved cell coordinates, nearby cells mostly having nearby codes.
+     */
+    inline std::uint32_t morton_code(float x, float y, float cell_size) {
+        constexpr float HALF_GRID = 32768.0f;
+        constexpr float MAX_CELL = 65535.0f;
+        float cell_x = std::floor(x / cell_size) + HALF_GRID;
+        float cell_y = std::floor(y / cell_size) + HALF_GRID;
+        // Written so that NaN coordinates also clamp to cell 0
+        cell_x = !(cell_x >= 0.0f) ? 0.0f : (cell_x > MAX_CELL ? MAX_CELL : cell_x);
+        cell_y = !(cell_y >= 0.0f) ? 0.0f : (cell_y > MAX_CELL ? MAX_CELL : cell_y);
+        return spread_bits(static_cast<std::uint32_t>(cell_x)) | (spread_bits(static_cast<std::uint32_t>(cell_y)) << 1);
+    }
+
+} // namespace lof
+
+#endif // LOF_MORTON_H
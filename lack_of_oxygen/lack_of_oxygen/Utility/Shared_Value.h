@@ -0,0 +1,102 @@
+/**
+ * @file Shared_Value.h
+ * @brief Defines the Shared_Value class, a copy-on-write handle for component data shared between entities.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_SHARED_VALUE_H
+#define LOF_SHARED_VALUE_H
+
+// Include standard headers
+#include <memory>
+#include <utility>
+
+namespace lof {
+
+    /**
+     * @class Shared_Value
+     * @brief Holds a value that copies of the handle share until one of them writes to it.
+     * @details Used for the heavy, rarely written members of components, such as asset names and
+     *          animation tables. Copying a component copies the handle, so every clone of a prefab
+     *          reads the prefab's data. write() gives the handle a private copy first if the data
+     *          is shared. Assigning a new value replaces the handle's data without copying the old.
+     * @tparam T The type of the value.
+     */
+    template<typename T>
+    class Shared_Value {
+    private:
+        std::shared_ptr<T> data; ///< The value, possibly shared with other handles
+
+    public:
+        /**
+         * @brief Construct a handle to a default-constructed value.
+         */
+        Shared_Value() : data(std::make_shared<T>()) {}
+
+        /**
+         * @brief Construct a handle to a value.
+         * @param value The value to hold.
+         */
+        Shared_Value(T value) : data(std::make_shared<T>(std::move(value))) {}
+
+        /**
+         * @brief Replace the handle's value, leaving other handles on the old one.
+         * @param value The new value.
+         * @return Reference to this handle.
+         */
+        Shared_Value& operator=(T value) {
+            data = std::make_shared<T>(std::move(value));
+            return *this;
+        }
+
+        /**
+         * @brief Get the value for reading.
+         * @return Const reference to the value.
+         */
+        const T& get() const {
+            return *data;
+        }
+
+        /**
+         * @brief Get the value for reading.
+         * @return Const reference to the value.
+         */
+        operator const T& () const {
+            return *data;
+        }
+
+        /**
+         * @brief Access the value's members for reading.
+         * @return Const pointer to the value.
+         */
+        const T* operator->() const {
+            return data.get();
+        }
+
+        /**
+         * @brief Get the value for writing, copying it first if other handles share it.
+         * @return Reference to the handle's own value.
+         */
+        T& write() {
+            if (data.use_count() > 1) {
+                data = std::make_shared<T>(*data);
+            }
+            return *data;
+        }
+
+        /**
+         * @brief Check if other handles share the value.
+         * @return True if the value is shared, false if the handle owns it alone.
+         */
+        bool is_shared() const {
+            return data.use_count() > 1;
+        }
+    };
+
+} // namespace lof
+
+#endif // LOF_SHARED_VALUE_H
@@ -0,0 +1,182 @@
+/**
+ * @file Sparse_Set.h
+ * @brief Defines the Sparse_Set class used for entity membership in systems.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_SPARSE_SET_H
+#define LOF_SPARSE_SET_H
+
+// Include standard headers
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+// Include other necessary headers
+#include "Type.h" // For EntityID
+
+namespace lof {
+
+    /**
+     * @class Sparse_Set
+     * @brief Set of entity IDs with O(1) insert, erase and lookup.
+     * @details Entities are packed in a dense array that is iterated in memory order, with a
+     *          sparse array mapping each entity slot index to its position in the dense array.
+     *          A lookup only succeeds when the stored ID matches the full ID, so stale handles
+     *          are never reported as members. Erasing swaps the last entity into the freed
+     *          position, so iteration order is stable between insertions and removals only.
+     */
+    class Sparse_Set {
+    public:
+        using const_iterator = std::vector<EntityID>::const_iterator;
+
+        static constexpr std::size_t INVALID_INDEX = std::numeric_limits<std::size_t>::max();
+
+    private:
+        std::vector<EntityID> dense;       ///< Packed member IDs
+        std::vector<std::size_t> sparse;   ///< Entity slot index to index into the dense array
+
+    public:
+        /**
+         * @brief Add an entity to the set.
+         * @param entity The ID of the entity to add.
+         * @return True if the entity was inserted, false if it was already a member.
+         */
+        bool insert(EntityID entity) {
+            std::uint32_t slot = entity_index(entity);
+            if (slot >= sparse.size()) {
+                sparse.resize(static_cast<std::size_t>(slot) + 1, INVALID_INDEX);
+            }
+
+            std::size_t index = sparse[slot];
+            if (index != INVALID_INDEX) {
+                if (dense[index] == entity) {
+                    return false;
+                }
+
+                // The slot is held by a stale handle, take it over in place
+                dense[index] = entity;
+                return true;
+            }
+
+            sparse[slot] = dense.size();
+            dense.push_back(entity);
+            return true;
+        }
+
+        /**
+         * @brief Remove an entity from the set.
+         * @param entity The ID of the entity to remove.
+         * @return True if the entity was removed, false if it was not a member.
+         */
+        bool erase(EntityID entity) {
+            if (!contains(entity)) {
+                return false;
+            }
+
+            // Move the last member into the freed position to keep the array packed
+            std::uint32_t slot = entity_index(entity);
+            std::size_t index = sparse[slot];
+            EntityID last = dense.back();
+            dense[index] = last;
+            sparse[entity_index(last)] = index;
+
+            dense.pop_back();
+            sparse[slot] = INVALID_INDEX;
+            return true;
+        }
+
+        /**
+         * @brief Check if an entity is a member of the set.
+         * @param entity The ID of the entity to check.
+         * @return True if the entity is in the set, false otherwise.
+         */
+        bool contains(EntityID entity) const {
+            std::uint32_t slot = entity_index(entity);
+            return slot < sparse.size() && sparse[slot] != INVALID_INDEX && dense[sparse[slot]] == entity;
+        }
+
+        /**
+         * @brief Get the number of members.
+         * @return The number of entities in the set.
+         */
+        std::size_t size() const {
+            return dense.size();
+        }
+
+        /**
+         * @brief Check if the set has no members.
+         * @return True if the set is empty, false otherwise.
+         */
+        bool empty() const {
+            return dense.empty();
+        }
+
+        /**
+         * @brief Remove every member from the set.
+         */
+        void clear() {
+            dense.clear();
+            sparse.clear();
+        }
+
+        /**
+         * @brief Reserve capacity in the dense array.
+         * @param capacity The number of members to reserve space for.
+         */
+        void reserve(std::size_t capacity) {
+            dense.reserve(capacity);
+        }
+
+        /**
+         * @brief Rearrange the members to follow a given order.
+         * @details Members listed in order come first, in that order. Members not listed follow in
+         *          their current relative order. Listed entities that are not members are ignored.
+         * @param order The preferred order of entity IDs.
+         */
+        void reorder(const std::vector<EntityID>& order) {
+            std::vector<EntityID> sorted;
+            sorted.reserve(dense.size());
+            std::vector<char> placed(dense.size(), 0);
+            for (EntityID entity : order) {
+                if (contains(entity)) {
+                    sorted.push_back(entity);
+                    placed[sparse[entity_index(entity)]] = 1;
+                }
+            }
+            for (std::size_t i = 0; i < dense.size(); ++i) {
+                if (!placed[i]) {
+                    sorted.push_back(dense[i]);
+                }
+            }
+
+            dense.swap(sorted);
+            for (std::size_t i = 0; i < dense.size(); ++i) {
+                sparse[entity_index(dense[i])] = i;
+            }
+        }
+
+        /**
+         * @brief Get the packed member array.
+         * @return Constant reference to the dense array of entity IDs.
+         */
+        const std::vector<EntityID>& data() const {
+            return dense;
+        }
+
+        const_iterator begin() const {
+            return dense.begin();
+        }
+
+        const_iterator end() const {
+            return dense.end();
+        }
+    };
+
+} // namespace lof
+
+#endif // LOF_SPARSE_SET_H
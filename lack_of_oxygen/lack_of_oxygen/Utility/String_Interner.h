@@ -0,0 +1,94 @@
+/**
+ * @file String_Interner.h
+ * @brief Defines the String_Interner class that maps strings to small integer IDs.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_STRING_INTERNER_H
+#define LOF_STRING_INTERNER_H
+
+// Include standard headers
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <cstddef>
+
+// Include other necessary headers
+#include "Type.h" // For NameID
+
+namespace lof {
+
+    /**
+     * @class String_Interner
+     * @brief Stores each distinct string once and hands out a dense NameID for it.
+     * @details IDs count up from 0 in interning order, so they can index plain vectors. Strings
+     *          live in a deque so the views used as map keys stay valid as more strings are added.
+     *          Lookups take a string_view and never build a temporary std::string.
+     */
+    class String_Interner {
+    private:
+        std::deque<std::string> strings;                       ///< Interned strings, indexed by NameID
+        std::unordered_map<std::string_view, NameID> ids;      ///< String to its NameID
+
+    public:
+        /**
+         * @brief Get the ID of a string, interning it if it is new.
+         * @param str The string to intern.
+         * @return The ID of the string.
+         */
+        NameID intern(std::string_view str) {
+            auto it = ids.find(str);
+            if (it != ids.end()) {
+                return it->second;
+            }
+
+            NameID id = static_cast<NameID>(strings.size());
+            strings.emplace_back(str);
+            ids.emplace(strings.back(), id);
+            return id;
+        }
+
+        /**
+         * @brief Get the ID of a string without interning it.
+         * @param str The string to look up.
+         * @return The ID of the string, INVALID_NAME_ID if it was never interned.
+         */
+        NameID find(std::string_view str) const {
+            auto it = ids.find(str);
+            return it != ids.end() ? it->second : INVALID_NAME_ID;
+        }
+
+        /**
+         * @brief Get the string of an ID.
+         * @param id An ID returned by intern().
+         * @return The interned string.
+         */
+        const std::string& get(NameID id) const {
+            return strings[id];
+        }
+
+        /**
+         * @brief Get the number of interned strings.
+         * @return The number of interned strings, which is also one past the largest ID.
+         */
+        std::size_t size() const {
+            return strings.size();
+        }
+
+        /**
+         * @brief Forget every interned string, invalidating all IDs.
+         */
+        void clear() {
+            ids.clear();
+            strings.clear();
+        }
+    };
+
+} // namespace lof
+
+#endif // LOF_STRING_INTERNER_H
@@ -7,11 +7,49 @@
 constexpr std::size_t MAX_COMPONENTS = 64; // Adjust as needed
 
 // Alias for the entity identifier type
+// The low ENTITY_INDEX_BITS hold the slot index, the remaining high bits hold the slot's generation
 using EntityID = std::uint32_t;
 
+// Layout of an EntityID
+constexpr std::uint32_t ENTITY_INDEX_BITS = 20;
+constexpr std::uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+constexpr std::uint32_t ENTITY_GENERATION_MASK = (1u << (32 - ENTITY_INDEX_BITS)) - 1;
+
 // Alias for the signature and component mask
 using Signature = std::bitset<MAX_COMPONENTS>;
 using ComponentMask = Signature; // Alias for clarity
 
+// Shared state outside the component pools that systems declare access to, like components
+enum System_Resource : std::size_t {
+    RESOURCE_ANIMATION_STORAGE, // Frame index and elapsed time of each animation in the Graphics_Manager
+    RESOURCE_COUNT
+};
+
+// Alias for a set of System_Resource
+using Resource_Mask = std::bitset<RESOURCE_COUNT>;
+
 // Constant representing an invalid entity ID
-constexpr EntityID INVALID_ENTITY_ID = std::numeric_limits<EntityID>::max();
\ No newline at end of file
+constexpr EntityID INVALID_ENTITY_ID = std::numeric_limits<EntityID>::max();
+
+// Generation reserved for entities recorded in a command buffer but not yet created
+constexpr std::uint32_t PENDING_ENTITY_GENERATION = ENTITY_GENERATION_MASK;
+
+// Maximum number of live entity slots (the all-ones index is reserved for INVALID_ENTITY_ID)
+constexpr std::uint32_t MAX_ENTITIES = ENTITY_INDEX_MASK;
+
+// Get the slot index of an entity ID
+constexpr std::uint32_t entity_index(EntityID entity) { return entity & ENTITY_INDEX_MASK; }
+
+// Get the generation of an entity ID
+constexpr std::uint32_t entity_generation(EntityID entity) { return entity >> ENTITY_INDEX_BITS; }
+
+// Build an entity ID from a slot index and a generation
+constexpr EntityID make_entity_id(std::uint32_t index, std::uint32_t generation) {
+    return ((generation & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+}
+
+// Alias for an interned string identifier
+using NameID = std::uint32_t;
+
+// Constant representing a string that was never interned
+constexpr NameID INVALID_NAME_ID = std::numeric_limits<NameID>::max();
@@ -0,0 +1,58 @@
+/**
+ * @file Type_List.h
+ * @brief Defines the Type_List template and compile-time index lookup used for component type IDs.
+ * @author agent (100%)
+ * @date October 16, 2026
+ * Copyright (C) 2024 DigiPen Institute of Technology.
+ * Reproduction or disclosure of this file or its contents without the
+ * prior written consent of DigiPen Institute of Technology is prohibited.
+ */
+#pragma once
+#ifndef LOF_TYPE_LIST_H
+#define LOF_TYPE_LIST_H
+
+// Include standard headers
+#include <cstddef>
+#include <type_traits>
+
+namespace lof {
+
+    /**
+     * @struct Type_List
+     * @brief Compile-time list of types.
+     * @tparam Ts The types in the list.
+     */
+    template<typename... Ts>
+    struct Type_List {
+        static constexpr std::size_t size = sizeof...(Ts);
+    };
+
+    /**
+     * @struct Type_List_Index
+     * @brief Gives the position of type T in a Type_List as a compile-time constant.
+     * @details Fails to compile if T is not in the list.
+     * @tparam T The type to look up.
+     * @tparam List The Type_List to search.
+     */
+    template<typename T, typename List>
+    struct Type_List_Index;
+
+    template<typename T>
+    struct Type_List_Index<T, Type_List<>> {
+        static_assert(!std::is_same_v<T, T>, "Type is not in the type list.");
+        static constexpr std::size_t value = 0;
+    };
+
+    template<typename T, typename... Ts>
+    struct Type_List_Index<T, Type_List<T, Ts...>> {
+        static constexpr std::size_t value = 0;
+    };
+
+    template<typename T, typename U, typename... Ts>
+    struct Type_List_Index<T, Type_List<U, Ts...>> {
+        static constexpr std::size_t value = 1 + Type_List_Index<T, Type_List<Ts...>>::value;
+    };
+
+} // namespace lof
+
+#endif // LOF_TYPE_LIST_H